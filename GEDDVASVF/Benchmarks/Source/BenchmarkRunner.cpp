@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    BenchmarkRunner.cpp
+    Created: 20 Oct 2026 1:40:12am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "BenchmarkRunner.h"
+
+namespace gedd
+{
+namespace bench
+{
+    BenchmarkRunner::BenchmarkRunner(const Options& optionsToUse)
+        : options(optionsToUse)
+    {
+        jassert(options.minRunSeconds > 0.0);
+    }
+
+    bool BenchmarkRunner::shouldRun(const juce::String& name) const
+    {
+        return options.filter.isEmpty() || name.containsIgnoreCase(options.filter);
+    }
+
+    void BenchmarkRunner::record(const juce::String& name, const juce::NamedValueSet& parameters, const juce::String& unit,
+                                 std::vector<Timing> samples)
+    {
+        if (samples.empty() || !shouldRun(name))
+            return;
+
+        std::sort(samples.begin(), samples.end(), [](const Timing& a, const Timing& b) { return a.nanoseconds < b.nanoseconds; });
+
+        const auto last = samples.size() - 1;
+        const auto& median = samples[samples.size() / 2];
+
+        Result r;
+        r.name = name;
+        r.parameters = parameters;
+        r.unit = unit;
+        r.unitsPerRun = static_cast<juce::int64>(samples.size());
+        r.nanoseconds = static_cast<double>(median.nanoseconds);
+        r.minNanoseconds = static_cast<double>(samples.front().nanoseconds);
+        r.p95Nanoseconds = static_cast<double>(samples[(last * 95 + 50) / 100].nanoseconds);
+        r.cycles = hasCycleCounter() ? static_cast<double>(median.cycles) : estimateCycles(r.nanoseconds);
+
+        addResult(r);
+    }
+
+    void BenchmarkRunner::addResult(const Result& r)
+    {
+        results.push_back(r);
+
+        if (onResult != nullptr)
+            onResult(r);
+    }
+
+    juce::var BenchmarkRunner::toVar() const
+    {
+        juce::Array<juce::var> list;
+
+        for (const auto& r : results)
+        {
+            auto* object = new juce::DynamicObject();
+            juce::var item(object);
+
+            object->setProperty("name", r.name);
+
+            auto* parameters = new juce::DynamicObject();
+            juce::var parametersVar(parameters);
+
+            for (const auto& p : r.parameters)
+                parameters->setProperty(p.name, p.value);
+
+            object->setProperty("parameters", parametersVar);
+            object->setProperty("unit", r.unit);
+            object->setProperty("ns", r.nanoseconds);
+            object->setProperty("nsMin", r.minNanoseconds);
+
+            if (r.p95Nanoseconds > 0.0)
+                object->setProperty("nsP95", r.p95Nanoseconds);
+
+            object->setProperty("cycles", r.cycles);
+            object->setProperty("units", r.unitsPerRun);
+
+            list.add(item);
+        }
+
+        return list;
+    }
+
+}   // namespace bench
+}   // namespace gedd
@@ -0,0 +1,223 @@
+/*
+  ==============================================================================
+
+    BenchmarkRunner.h
+    Created: 20 Oct 2026 1:40:12am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+#include <chrono>
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace gedd
+{
+namespace bench
+{
+    /*
+        Times a callable and reports the cost per unit of work, e.g. per sample,
+        per call or per frequency point.
+
+        Each benchmark is calibrated to run for at least the minimum run time, then
+        repeated and the median run is reported, so one preempted run doesn't move
+        the result. Cycles come from the time stamp counter where there is one,
+        otherwise they are estimated from the nominal cpu speed.
+    */
+    class BenchmarkRunner
+    {
+    public:
+        struct Options
+        {
+            double minRunSeconds{ 0.01 };
+            int repetitions{ 5 };
+            juce::String filter;        // only benchmarks whose name contains this
+        };
+
+        struct Result
+        {
+            juce::String name;
+            juce::NamedValueSet parameters;
+            juce::String unit;
+
+            double nanoseconds{ 0.0 }, cycles{ 0.0 };       // per unit, median run
+            double minNanoseconds{ 0.0 };                   // per unit, fastest run
+            double p95Nanoseconds{ 0.0 };                   // per unit, only for recorded samples
+            juce::int64 unitsPerRun{ 0 };
+        };
+
+        // one timed call
+        struct Timing
+        {
+            juce::int64 nanoseconds{ 0 };
+            juce::uint64 cycles{ 0 };
+        };
+
+        explicit BenchmarkRunner(const Options& optionsToUse);
+
+        bool shouldRun(const juce::String& name) const;
+
+        /*
+            fn() does unitsPerCall units of work each time it is called. Its return value
+            is accumulated into a sink so the work can't be optimised away.
+        */
+        template<typename Fn>
+        void run(const juce::String& name, const juce::NamedValueSet& parameters, const juce::String& unit,
+                 juce::int64 unitsPerCall, Fn&& fn)
+        {
+            jassert(unitsPerCall > 0);
+
+            if (!shouldRun(name))
+                return;
+
+            // warm up and find how many calls fill the minimum run time
+            auto calls = juce::int64{ 1 };
+
+            for (;;)
+            {
+                const auto seconds = static_cast<double>(timeCalls(calls, fn).nanoseconds) * 1.0e-9;
+
+                if (seconds >= options.minRunSeconds || calls >= (juce::int64{ 1 } << 40))
+                    break;
+
+                calls *= seconds > 0.0 ? juce::jlimit<juce::int64>(2, 16, static_cast<juce::int64>(options.minRunSeconds / seconds) + 1) : 16;
+            }
+
+            std::vector<Timing> timings;
+
+            for (auto i = 0; i != juce::jmax(1, options.repetitions); ++i)
+                timings.push_back(timeCalls(calls, fn));
+
+            std::sort(timings.begin(), timings.end(), [](const Timing& a, const Timing& b) { return a.nanoseconds < b.nanoseconds; });
+
+            const auto& median = timings[timings.size() / 2];
+            const auto units = static_cast<double>(calls * unitsPerCall);
+
+            Result r;
+            r.name = name;
+            r.parameters = parameters;
+            r.unit = unit;
+            r.unitsPerRun = calls * unitsPerCall;
+            r.nanoseconds = static_cast<double>(median.nanoseconds) / units;
+            r.minNanoseconds = static_cast<double>(timings.front().nanoseconds) / units;
+            r.cycles = hasCycleCounter() ? static_cast<double>(median.cycles) / units : estimateCycles(r.nanoseconds);
+
+            addResult(r);
+        }
+
+        /*
+            For work that can't be repeated on its own, e.g. a frame that depends on the
+            frames before it. The caller times each unit with time(); the median, fastest
+            and 95th percentile are reported.
+        */
+        void record(const juce::String& name, const juce::NamedValueSet& parameters, const juce::String& unit,
+                    std::vector<Timing> samples);
+
+        template<typename Fn>
+        static Timing time(Fn&& fn)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            const auto startCycles = readCycleCounter();
+            const auto start = Clock::now();
+
+            fn();
+
+            const auto end = Clock::now();
+            const auto endCycles = readCycleCounter();
+
+            Timing t;
+            t.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            t.cycles = endCycles - startCycles;
+            return t;
+        }
+
+        const std::vector<Result>& getResults() const noexcept { return results; }
+
+        // machine readable, see Main.cpp for the layout
+        juce::var toVar() const;
+
+        static bool hasCycleCounter() noexcept
+        {
+           #if JUCE_INTEL
+            return true;
+           #else
+            return false;
+           #endif
+        }
+
+        static juce::uint64 readCycleCounter() noexcept
+        {
+           #if JUCE_INTEL
+            return static_cast<juce::uint64>(__rdtsc());
+           #else
+            return 0;
+           #endif
+        }
+
+        // progress, e.g. to stderr
+        std::function<void(const Result&)> onResult;
+
+    private:
+        void addResult(const Result& r);
+
+        static double estimateCycles(double nanoseconds) noexcept
+        {
+            return nanoseconds * static_cast<double>(juce::SystemStats::getCpuSpeedInMegahertz()) * 1.0e-3;
+        }
+
+        template<typename Fn>
+        Timing timeCalls(juce::int64 calls, Fn& fn)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            auto sum = 0.0;
+
+            const auto startCycles = readCycleCounter();
+            const auto start = Clock::now();
+
+            for (juce::int64 i = 0; i != calls; ++i)
+                sum += static_cast<double>(fn());
+
+            const auto end = Clock::now();
+            const auto endCycles = readCycleCounter();
+
+            sink = sink + sum;
+
+            Timing t;
+            t.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            t.cycles = endCycles - startCycles;
+            return t;
+        }
+
+        Options options;
+        std::vector<Result> results;
+
+        volatile double sink{ 0.0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BenchmarkRunner)
+    };
+
+    // e.g. makeParameters({ { "type", "float" }, { "blockSize", 64 } })
+    inline juce::NamedValueSet makeParameters(std::initializer_list<juce::NamedValueSet::NamedValue> values)
+    {
+        juce::NamedValueSet set;
+
+        for (const auto& v : values)
+            set.set(v.name, v.value);
+
+        return set;
+    }
+
+}   // namespace bench
+}   // namespace gedd
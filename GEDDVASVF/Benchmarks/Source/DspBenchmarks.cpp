@@ -0,0 +1,286 @@
+/*
+  ==============================================================================
+
+    DspBenchmarks.cpp
+    Created: 20 Oct 2026 1:58:45am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "DspBenchmarks.h"
+#include "../../Source/VASVF.h"
+#include "../../Source/VASVFProcessor.h"
+
+namespace gedd
+{
+namespace bench
+{
+namespace
+{
+    using namespace gedd::dsp;
+    using VASVF::FilterType;
+
+    template<typename SampleType>
+    const char* getTypeName() noexcept { return std::is_same<SampleType, float>::value ? "float" : "double"; }
+
+    juce::String getFilterName(FilterType type)
+    {
+        return *(VASVF::filterTypeStr.begin() + static_cast<int>(type));
+    }
+
+    std::vector<FilterType> getFilterTypes()
+    {
+        std::vector<FilterType> types;
+
+        for (auto t = static_cast<int>(FilterType::lowpass); t != static_cast<int>(FilterType::numTypes); ++t)
+            types.push_back(static_cast<FilterType>(t));
+
+        return types;
+    }
+
+    // white noise at -6 dBFS, the same for every run
+    template<typename SampleType>
+    void fillNoise(juce::AudioBuffer<SampleType>& buffer)
+    {
+        juce::Random random(0x47454444);
+
+        for (auto ch = 0; ch != buffer.getNumChannels(); ++ch)
+            for (auto i = 0; i != buffer.getNumSamples(); ++i)
+                buffer.setSample(ch, i, static_cast<SampleType>(random.nextDouble() - 0.5));
+    }
+
+    template<typename SampleType>
+    typename VASVF::State<SampleType>::Ptr makeState(FilterType type, double sampleRate)
+    {
+        return new VASVF::State<SampleType>(VASVF::ArrayState<SampleType>::make(type, sampleRate,
+            static_cast<SampleType>(1000), static_cast<SampleType>(6), static_cast<SampleType>(0.707), false, static_cast<SampleType>(1.5)));
+    }
+
+    //==============================================================================
+    template<typename SampleType>
+    void runFilterBenchmarks(BenchmarkRunner& runner, const DspSweep& sweep)
+    {
+        const auto maxBlockSize = *std::max_element(sweep.blockSizes.begin(), sweep.blockSizes.end());
+        const auto maxChannels = *std::max_element(sweep.channelCounts.begin(), sweep.channelCounts.end());
+
+        juce::AudioBuffer<SampleType> input(maxChannels, maxBlockSize), output(maxChannels, maxBlockSize);
+        fillNoise(input);
+
+        const juce::dsp::ProcessSpec monoSpec{ sweep.sampleRate, static_cast<juce::uint32>(maxBlockSize), 1 };
+
+        for (const auto type : getFilterTypes())
+        {
+            const auto state = makeState<SampleType>(type, sweep.sampleRate);
+
+            // processSample, the block size only sets how much input is cycled through
+            {
+                VASVF::Filter<SampleType> filter(state);
+                filter.prepare(monoSpec);
+
+                const auto* src = input.getReadPointer(0);
+
+                runner.run("Filter::processSample", makeParameters({ { "type", getTypeName<SampleType>() }, { "filter", getFilterName(type) } }),
+                           "sample", maxBlockSize, [&]
+                {
+                    auto sum = SampleType(0);
+
+                    for (auto i = 0; i != maxBlockSize; ++i)
+                        sum += filter.processSample(src[i]);
+
+                    return sum;
+                });
+            }
+
+            for (const auto channels : sweep.channelCounts)
+            {
+                for (const auto blockSize : sweep.blockSizes)
+                {
+                    std::vector<VASVF::Filter<SampleType>> filters;
+
+                    for (auto ch = 0; ch != channels; ++ch)
+                    {
+                        filters.emplace_back(state);
+                        filters.back().prepare(monoSpec);
+                    }
+
+                    const juce::dsp::AudioBlock<SampleType> inputBlock(input.getArrayOfWritePointers(), static_cast<size_t>(channels), static_cast<size_t>(blockSize));
+                    juce::dsp::AudioBlock<SampleType> outputBlock(output.getArrayOfWritePointers(), static_cast<size_t>(channels), static_cast<size_t>(blockSize));
+
+                    runner.run("Filter::process", makeParameters({ { "type", getTypeName<SampleType>() }, { "filter", getFilterName(type) },
+                                                                   { "channels", channels }, { "blockSize", blockSize } }),
+                               "sample", static_cast<juce::int64>(channels) * blockSize, [&]
+                    {
+                        for (size_t ch = 0; ch != filters.size(); ++ch)
+                        {
+                            const auto in = inputBlock.getSingleChannelBlock(ch);
+                            auto out = outputBlock.getSingleChannelBlock(ch);
+
+                            filters[ch].process(juce::dsp::ProcessContextNonReplacing<SampleType>(in, out));
+                        }
+
+                        return outputBlock.getSample(0, blockSize - 1);
+                    });
+                }
+            }
+        }
+    }
+
+    //==============================================================================
+    template<typename SampleType>
+    void runProcessorBenchmarks(BenchmarkRunner& runner, const DspSweep& sweep)
+    {
+        const auto maxBlockSize = *std::max_element(sweep.blockSizes.begin(), sweep.blockSizes.end());
+        const auto maxChannels = *std::max_element(sweep.channelCounts.begin(), sweep.channelCounts.end());
+
+        juce::AudioBuffer<SampleType> input(maxChannels, maxBlockSize), buffer(maxChannels, maxBlockSize);
+        fillNoise(input);
+
+        for (const auto type : getFilterTypes())
+        {
+            for (const auto smoothing : { false, true })
+            {
+                for (const auto channels : sweep.channelCounts)
+                {
+                    for (const auto blockSize : sweep.blockSizes)
+                    {
+                        VASVFProcessor<SampleType> processor;
+                        processor.setType(type);
+                        processor.setFrequency(static_cast<SampleType>(1000));
+                        processor.setGain(static_cast<SampleType>(6));
+                        processor.setMorph(static_cast<SampleType>(1.5));
+                        processor.setRampDurationSeconds(1.0);
+                        processor.prepare({ sweep.sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(channels) });
+                        processor.reset();
+
+                        juce::dsp::AudioBlock<SampleType> block(buffer.getArrayOfWritePointers(), static_cast<size_t>(channels), static_cast<size_t>(blockSize));
+                        const juce::dsp::AudioBlock<SampleType> inputBlock(input.getArrayOfWritePointers(), static_cast<size_t>(channels), static_cast<size_t>(blockSize));
+
+                        // while smoothing the targets keep moving, so every block ramps and redesigns
+                        auto toggle = false;
+
+                        runner.run("VASVFProcessor::process", makeParameters({ { "type", getTypeName<SampleType>() }, { "filter", getFilterName(type) },
+                                                                                { "channels", channels }, { "blockSize", blockSize }, { "smoothing", smoothing } }),
+                                   "sample", static_cast<juce::int64>(channels) * blockSize, [&]
+                        {
+                            if (smoothing)
+                            {
+                                toggle = !toggle;
+                                processor.setFrequency(static_cast<SampleType>(toggle ? 2000 : 500));
+                                processor.setGain(static_cast<SampleType>(toggle ? 9 : -9));
+                                processor.setQ(static_cast<SampleType>(toggle ? 2 : 0.5));
+                                processor.setMorph(static_cast<SampleType>(toggle ? 3 : 0.5));
+                            }
+
+                            block.copyFrom(inputBlock);
+                            processor.process(juce::dsp::ProcessContextReplacing<SampleType>(block));
+
+                            return block.getSample(0, blockSize - 1);
+                        });
+                    }
+                }
+            }
+        }
+    }
+
+    //==============================================================================
+    template<typename SampleType>
+    void runDesignBenchmarks(BenchmarkRunner& runner, const DspSweep& sweep)
+    {
+        using AS = VASVF::ArrayState<SampleType>;
+        using S = VASVF::State<SampleType>;
+
+        const auto sr = sweep.sampleRate;
+
+        // a slowly moving frequency so no call can be folded into the last
+        auto frequency = static_cast<SampleType>(1000);
+        auto next = [&frequency]
+        {
+            frequency = frequency > static_cast<SampleType>(10000) ? static_cast<SampleType>(100) : frequency * static_cast<SampleType>(1.001);
+            return frequency;
+        };
+
+        // generic lambdas, so no call goes through a std::function
+        const auto g = static_cast<SampleType>(6), q = static_cast<SampleType>(0.707), m = static_cast<SampleType>(1.5);
+
+        auto array = [&](const char* name, auto make)
+        {
+            runner.run(juce::String("ArrayState::") + name, makeParameters({ { "type", getTypeName<SampleType>() } }), "call", 1,
+                       [&] { return make(next())[1]; });
+        };
+
+        auto state = [&](const char* name, auto make)
+        {
+            runner.run(juce::String("State::") + name, makeParameters({ { "type", getTypeName<SampleType>() } }), "call", 1,
+                       [&] { return make(next())->data[1]; });
+        };
+
+        array("makeLowpass",   [&](SampleType f) { return AS::makeLowpass(sr, f, q); });
+        array("makeBandpass",  [&](SampleType f) { return AS::makeBandpass(sr, f, q); });
+        array("makeHighpass",  [&](SampleType f) { return AS::makeHighpass(sr, f, q); });
+        array("makeNotch",     [&](SampleType f) { return AS::makeNotch(sr, f, q); });
+        array("makeAllpass",   [&](SampleType f) { return AS::makeAllpass(sr, f, q); });
+        array("makeBell",      [&](SampleType f) { return AS::makeBell(sr, f, g, q, true); });
+        array("makeLowshelf",  [&](SampleType f) { return AS::makeLowshelf(sr, f, g, q, true); });
+        array("makeHighshelf", [&](SampleType f) { return AS::makeHighshelf(sr, f, g, q, true); });
+        array("makeMorph",     [&](SampleType f) { return AS::makeMorph(sr, f, q, m); });
+
+        state("makeLowpass",   [&](SampleType f) { return S::makeLowpass(sr, f, q); });
+        state("makeBandpass",  [&](SampleType f) { return S::makeBandpass(sr, f, q); });
+        state("makeHighpass",  [&](SampleType f) { return S::makeHighpass(sr, f, q); });
+        state("makeNotch",     [&](SampleType f) { return S::makeNotch(sr, f, q); });
+        state("makeAllpass",   [&](SampleType f) { return S::makeAllpass(sr, f, q); });
+        state("makeBell",      [&](SampleType f) { return S::makeBell(sr, f, g, q, true); });
+        state("makeLowshelf",  [&](SampleType f) { return S::makeLowshelf(sr, f, g, q, true); });
+        state("makeHighshelf", [&](SampleType f) { return S::makeHighshelf(sr, f, g, q, true); });
+        state("makeMorph",     [&](SampleType f) { return S::makeMorph(sr, f, q, m); });
+    }
+
+    //==============================================================================
+    template<typename SampleType>
+    void runResponseBenchmarks(BenchmarkRunner& runner, const DspSweep& sweep)
+    {
+        for (const auto type : getFilterTypes())
+        {
+            const auto state = makeState<SampleType>(type, sweep.sampleRate);
+
+            for (const auto numPoints : sweep.numFrequencyPoints)
+            {
+                std::vector<double> frequencies(static_cast<size_t>(numPoints)), magnitudes(static_cast<size_t>(numPoints));
+
+                const auto range = juce::NormalisableRange<double>(20.0, 20000.0, 0.0, 0.2);
+
+                for (auto i = 0; i != numPoints; ++i)
+                    frequencies[static_cast<size_t>(i)] = range.convertFrom0to1(static_cast<double>(i) / static_cast<double>(numPoints - 1));
+
+                runner.run("State::getMagnitudeForFrequencyArray", makeParameters({ { "type", getTypeName<SampleType>() }, { "filter", getFilterName(type) },
+                                                                                     { "points", numPoints } }),
+                           "point", numPoints, [&]
+                {
+                    state->getMagnitudeForFrequencyArray(frequencies.data(), magnitudes.data(), frequencies.size(), sweep.sampleRate);
+                    return magnitudes.back();
+                });
+            }
+        }
+    }
+}
+
+    void runDspBenchmarks(BenchmarkRunner& runner, const DspSweep& sweep)
+    {
+        jassert(!sweep.blockSizes.empty() && !sweep.channelCounts.empty() && !sweep.numFrequencyPoints.empty());
+
+        runFilterBenchmarks<float>(runner, sweep);
+        runFilterBenchmarks<double>(runner, sweep);
+
+        runProcessorBenchmarks<float>(runner, sweep);
+        runProcessorBenchmarks<double>(runner, sweep);
+
+        runDesignBenchmarks<float>(runner, sweep);
+        runDesignBenchmarks<double>(runner, sweep);
+
+        runResponseBenchmarks<float>(runner, sweep);
+        runResponseBenchmarks<double>(runner, sweep);
+    }
+
+}   // namespace bench
+}   // namespace gedd
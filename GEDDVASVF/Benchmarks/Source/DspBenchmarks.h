@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+
+    DspBenchmarks.h
+    Created: 20 Oct 2026 1:58:45am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "BenchmarkRunner.h"
+
+namespace gedd
+{
+namespace bench
+{
+    struct DspSweep
+    {
+        std::vector<int> blockSizes{ 16, 64, 256, 1024 };
+        std::vector<int> channelCounts{ 1, 2, 8 };
+        std::vector<int> numFrequencyPoints{ 128, 512, 2048 };
+        double sampleRate{ 48000.0 };
+    };
+
+    /*
+        The VASVF kernels, for float and double and every filter type:
+
+            Filter::processSample()             per sample, one channel
+            Filter::process()                   per sample, a filter per channel
+            VASVFProcessor::process()           per sample, settled and while smoothing
+            ArrayState::make*(), State::make*() per call
+            State::getMagnitudeForFrequencyArray() per frequency point
+    */
+    void runDspBenchmarks(BenchmarkRunner& runner, const DspSweep& sweep);
+
+}   // namespace bench
+}   // namespace gedd
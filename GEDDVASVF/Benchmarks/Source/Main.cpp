@@ -0,0 +1,165 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 1:40:12am
+    Author:  GEDD
+
+    Benchmarks for the VASVF kernels and the response display, results are
+    written as json:
+
+        {
+            "schema": 1,
+            "build": "Release",
+            "system": { "cpu", "mhz", "cores", "os", "juce", "cycleCounter" },
+            "results": [ { "name", "parameters": {...}, "unit", "ns", "nsMin", "nsP95", "cycles", "units" } ]
+        }
+
+    ns and cycles are per unit (sample, call, point or frame) for the median run,
+    nsMin for the fastest. Frames are timed one at a time, so those results also
+    have nsP95, the 95th percentile. cycleCounter is "tsc" when cycles were counted
+    and "estimated" when they were derived from the nominal cpu speed.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "BenchmarkRunner.h"
+#include "DspBenchmarks.h"
+#include "UiBenchmarks.h"
+
+namespace
+{
+    void printUsage()
+    {
+        std::cout << "GEDDVASVFBenchmarks [options]\n"
+                     "  --suite <dsp|ui|all>    which benchmarks to run, default all\n"
+                     "  --filter <text>         only run benchmarks whose name contains text\n"
+                     "  --output <file>         write the json to a file instead of stdout\n"
+                     "  --min-run-time <s>      minimum length of each timed run, default 0.01\n"
+                     "  --repetitions <n>       timed runs per benchmark, the median is reported, default 5\n"
+                     "  --frames <n>            frames per ui script, default 120\n"
+                     "  --quick                 fewer sizes and shorter runs, for a smoke test\n"
+                     "  --help\n";
+    }
+
+    juce::var getSystemInfo()
+    {
+        auto* object = new juce::DynamicObject();
+        juce::var info(object);
+
+        object->setProperty("cpu", (juce::SystemStats::getCpuVendor() + " " + juce::SystemStats::getCpuModel()).trim());
+        object->setProperty("mhz", juce::SystemStats::getCpuSpeedInMegahertz());
+        object->setProperty("cores", juce::SystemStats::getNumPhysicalCpus());
+        object->setProperty("os", juce::SystemStats::getOperatingSystemName());
+        object->setProperty("juce", juce::SystemStats::getJUCEVersion());
+        object->setProperty("cycleCounter", gedd::bench::BenchmarkRunner::hasCycleCounter() ? "tsc" : "estimated");
+
+        return info;
+    }
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    const auto quick = args.containsOption("--quick");
+    const auto suite = args.containsOption("--suite") ? args.getValueForOption("--suite") : juce::String("all");
+
+    if (suite != "all" && suite != "dsp" && suite != "ui")
+    {
+        std::cerr << "unknown suite " << suite << "\n";
+        printUsage();
+        return 1;
+    }
+
+    gedd::bench::BenchmarkRunner::Options options;
+    options.filter = args.getValueForOption("--filter");
+    options.minRunSeconds = quick ? 0.002 : 0.01;
+    options.repetitions = quick ? 3 : 5;
+
+    if (args.containsOption("--min-run-time"))
+        options.minRunSeconds = juce::jmax(1.0e-4, args.getValueForOption("--min-run-time").getDoubleValue());
+
+    if (args.containsOption("--repetitions"))
+        options.repetitions = juce::jmax(1, args.getValueForOption("--repetitions").getIntValue());
+
+    gedd::bench::DspSweep sweep;
+    gedd::bench::UiSweep uiSweep;
+
+    if (quick)
+    {
+        sweep.blockSizes = { 64, 512 };
+        sweep.channelCounts = { 2 };
+        sweep.numFrequencyPoints = { 512 };
+
+        uiSweep.sizes = { { 480, 300 } };
+        uiSweep.scales = { 1.0f, 2.0f };
+        uiSweep.numFrames = 30;
+    }
+
+    if (args.containsOption("--frames"))
+        uiSweep.numFrames = juce::jmax(1, args.getValueForOption("--frames").getIntValue());
+
+   #if JUCE_DEBUG
+    std::cerr << "warning: this is a debug build, the results won't mean much. Build with CONFIG=Release\n";
+   #endif
+
+    gedd::bench::BenchmarkRunner runner(options);
+
+    runner.onResult = [](const gedd::bench::BenchmarkRunner::Result& r)
+    {
+        juce::StringArray parameters;
+
+        for (const auto& p : r.parameters)
+            parameters.add(p.name.toString() + "=" + p.value.toString());
+
+        std::cerr << r.name << " " << parameters.joinIntoString(" ") << ": "
+                  << juce::String(r.nanoseconds, 3) << " ns/" << r.unit << ", "
+                  << juce::String(r.cycles, 2) << " cycles/" << r.unit << "\n";
+    };
+
+    if (suite != "ui")
+        gedd::bench::runDspBenchmarks(runner, sweep);
+
+    if (suite != "dsp")
+        gedd::bench::runUiBenchmarks(runner, uiSweep);
+
+    auto* object = new juce::DynamicObject();
+    juce::var document(object);
+
+    object->setProperty("schema", 1);
+   #if JUCE_DEBUG
+    object->setProperty("build", "Debug");
+   #else
+    object->setProperty("build", "Release");
+   #endif
+    object->setProperty("system", getSystemInfo());
+    object->setProperty("results", runner.toVar());
+
+    const auto json = juce::JSON::toString(document);
+
+    if (args.containsOption("--output"))
+    {
+        const auto file = args.getFileForOption("--output");
+
+        if (!file.replaceWithText(json))
+        {
+            std::cerr << "couldn't write " << file.getFullPathName() << "\n";
+            return 1;
+        }
+    }
+    else
+    {
+        std::cout << json << "\n";
+    }
+
+    return 0;
+}
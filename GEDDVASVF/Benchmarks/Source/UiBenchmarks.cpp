@@ -0,0 +1,259 @@
+/*
+  ==============================================================================
+
+    UiBenchmarks.cpp
+    Created: 20 Oct 2026 3:12:40am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "UiBenchmarks.h"
+#include "../../Source/ParameterReference.h"
+#include "../../Source/VASVFTraceComponent.h"
+#include "../../Source/FrequencyDecibelGridOverlay.h"
+#include "../../Source/TraceAndGrid.h"
+
+namespace gedd
+{
+namespace bench
+{
+namespace
+{
+    using FilterType = gedd::dsp::VASVF::FilterType;
+
+    // owns the parameters the components listen to, nothing is processed
+    class ParameterHost : public juce::AudioProcessor
+    {
+    public:
+        ParameterHost()
+            : apvts(*this, nullptr, "PARAMETERS", createLayout()),
+            ref(apvts, ID::group::EQ)
+        {}
+
+        EQParameterReference& getReference() noexcept { return ref; }
+
+        const juce::String getName() const override { return "ParameterHost"; }
+        void prepareToPlay(double, int) override {}
+        void releaseResources() override {}
+        void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override {}
+        double getTailLengthSeconds() const override { return 0.0; }
+        bool acceptsMidi() const override { return false; }
+        bool producesMidi() const override { return false; }
+        juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+        bool hasEditor() const override { return false; }
+        int getNumPrograms() override { return 1; }
+        int getCurrentProgram() override { return 0; }
+        void setCurrentProgram(int) override {}
+        const juce::String getProgramName(int) override { return {}; }
+        void changeProgramName(int, const juce::String&) override {}
+        void getStateInformation(juce::MemoryBlock&) override {}
+        void setStateInformation(const void*, int) override {}
+
+    private:
+        static juce::AudioProcessorValueTreeState::ParameterLayout createLayout()
+        {
+            juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+            auto params = EQParameterReference::createParamGroup(ID::group::EQ);
+            layout.add(params.begin(), params.end());
+
+            return layout;
+        }
+
+        juce::AudioProcessorValueTreeState apvts;
+        EQParameterReference ref;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterHost)
+    };
+
+    struct Script
+    {
+        juce::String name;
+        std::function<void()> setup;
+
+        // once per frame, position goes 0 to 1 over the frames. nullptr for nothing
+        std::function<void(int frame, double position)> step;
+    };
+
+    struct Target
+    {
+        juce::String name;
+        juce::Component& component;
+        std::function<void(double scale)> setScale;
+        std::vector<Script> scripts;
+    };
+
+    void setValue(juce::RangedAudioParameter& param, float value)
+    {
+        param.setValueNotifyingHost(param.convertTo0to1(value));
+    }
+
+    void setParameters(EQParameterReference& ref, FilterType type, float freq, float gain, float q, float morph)
+    {
+        setValue(ref.type, static_cast<float>(type));
+        setValue(ref.freq, freq);
+        setValue(ref.gain, gain);
+        setValue(ref.q, q);
+        setValue(ref.autoq, 0.0f);
+        setValue(ref.morph, morph);
+    }
+
+    // what the editor sees while a control is dragged, update() recomputes the trace. "static" changes nothing
+    std::vector<Script> makeParameterScripts(EQParameterReference& ref, std::function<void()> update)
+    {
+        return {
+            { "static",
+              [&ref] { setParameters(ref, FilterType::bell, 1000.0f, 12.0f, 2.0f, 0.0f); },
+              nullptr },
+
+            { "frequency",
+              [&ref] { setParameters(ref, FilterType::bell, 1000.0f, 12.0f, 2.0f, 0.0f); },
+              [&ref, update](int, double position) { ref.freq.setValueNotifyingHost(static_cast<float>(position)); update(); } },
+
+            { "q",
+              [&ref] { setParameters(ref, FilterType::bell, 1000.0f, 12.0f, 2.0f, 0.0f); },
+              [&ref, update](int, double position) { ref.q.setValueNotifyingHost(static_cast<float>(position)); update(); } },
+
+            { "morph",
+              [&ref] { setParameters(ref, FilterType::morph, 1000.0f, 6.0f, 0.707f, 0.0f); },
+              [&ref, update](int, double position) { ref.morph.setValueNotifyingHost(static_cast<float>(position)); update(); } },
+
+            { "type",
+              [&ref] { setParameters(ref, FilterType::bell, 1000.0f, 12.0f, 2.0f, 1.5f); },
+              [&ref, update](int frame, double)
+              {
+                  const auto numTypes = static_cast<int>(FilterType::numTypes) - static_cast<int>(FilterType::lowpass);
+                  setValue(ref.type, static_cast<float>(static_cast<int>(FilterType::lowpass) + frame % numTypes));
+                  update();
+              } }
+        };
+    }
+
+    void render(juce::Component& component, juce::Image& image, float scale)
+    {
+        juce::Graphics g(image);
+        g.addTransform(juce::AffineTransform::scale(scale));
+
+        component.paintEntireComponent(g, true);
+    }
+
+    void runTarget(BenchmarkRunner& runner, const Target& target, const UiSweep& sweep)
+    {
+        const auto updateName = target.name + "::update";
+        const auto paintName = target.name + "::paint";
+
+        if (!runner.shouldRun(updateName) && !runner.shouldRun(paintName))
+            return;
+
+        for (const auto& script : target.scripts)
+        {
+            for (const auto size : sweep.sizes)
+            {
+                for (const auto scale : sweep.scales)
+                {
+                    const auto parameters = makeParameters({ { "script", script.name }, { "width", size.x }, { "height", size.y }, { "scale", scale } });
+
+                    target.component.setBounds(0, 0, size.x, size.y);
+
+                    if (script.setup != nullptr)
+                        script.setup();
+
+                    if (target.setScale != nullptr)
+                        target.setScale(static_cast<double>(scale));
+
+                    juce::Image image(juce::Image::ARGB, juce::roundToInt(static_cast<float>(size.x) * scale),
+                                      juce::roundToInt(static_cast<float>(size.y) * scale), true, juce::SoftwareImageType());
+
+                    // the first frame fills the caches
+                    render(target.component, image, scale);
+
+                    std::vector<BenchmarkRunner::Timing> updates, paints;
+
+                    for (auto frame = 0; frame != sweep.numFrames; ++frame)
+                    {
+                        const auto position = sweep.numFrames > 1 ? static_cast<double>(frame) / static_cast<double>(sweep.numFrames - 1) : 0.0;
+
+                        if (script.step != nullptr)
+                            updates.push_back(BenchmarkRunner::time([&] { script.step(frame, position); }));
+
+                        image.clear(image.getBounds());
+
+                        paints.push_back(BenchmarkRunner::time([&] { render(target.component, image, scale); }));
+                    }
+
+                    runner.record(updateName, parameters, "frame", std::move(updates));
+                    runner.record(paintName, parameters, "frame", std::move(paints));
+                }
+            }
+        }
+    }
+}
+
+    //==============================================================================
+    void runUiBenchmarks(BenchmarkRunner& runner, const UiSweep& sweep)
+    {
+        jassert(sweep.numFrames > 0);
+
+        // message manager and fonts, nothing goes on the desktop
+        const juce::ScopedJuceInitialiser_GUI gui;
+
+        ParameterHost host;
+        auto& ref = host.getReference();
+
+        // the trace on its own, offscreen from the start so the display thread and frame timer never run
+        {
+            VASVFTraceComponent trace(ref, 1.0);
+
+            const auto scripts = makeParameterScripts(ref, [&trace] { trace.update(); });
+
+            runTarget(runner, { "VASVFTraceComponent", trace, [&trace](double scale) { trace.setOffscreenScale(scale); trace.update(); }, scripts }, sweep);
+        }
+
+        // the grid on its own, it only changes with the ranges
+        {
+            FrequencyDecibelGridOverlay grid;
+            grid.setColour(FrequencyDecibelGridOverlay::backgroundColourID, juce::Colours::black);
+
+            const auto resetRanges = [&grid]
+            {
+                grid.setFrequencyRange(20.0, 18000.0);
+                grid.setDecibelRange(-24.0, 24.0);
+            };
+
+            std::vector<Script> scripts{
+                { "static", resetRanges, nullptr },
+
+                { "decibelRange", resetRanges, [&grid](int, double position)
+                  {
+                      const auto top = 6.0 + position * 42.0;
+                      grid.setDecibelRange(-top, top);
+                  } },
+
+                { "frequencyRange", resetRanges, [&grid](int, double position) { grid.setFrequencyRange(20.0, 2000.0 + position * 20000.0); } }
+            };
+
+            runTarget(runner, { "FrequencyDecibelGridOverlay", grid, nullptr, scripts }, sweep);
+        }
+
+        // all of it, as the editor draws it. No analysers, so nothing else starts the display thread
+        {
+            TraceAndGrid traceAndGrid(ref, 1.0);
+
+            auto scripts = makeParameterScripts(ref, [&traceAndGrid] { traceAndGrid.updateTrace(); });
+
+            scripts.push_back({ "ranges",
+                [&traceAndGrid] { traceAndGrid.setRanges({ 20.0, 18000.0 }, { -24.0, 24.0 }); },
+                [&traceAndGrid](int, double position)
+                {
+                    const auto top = 6.0 + position * 42.0;
+                    traceAndGrid.setRanges({ 20.0, 2000.0 + position * 20000.0 }, { -top, top });
+                    traceAndGrid.updateTrace();
+                } });
+
+            runTarget(runner, { "TraceAndGrid", traceAndGrid, [&traceAndGrid](double scale) { traceAndGrid.setOffscreenScale(scale); traceAndGrid.updateTrace(); }, scripts }, sweep);
+        }
+    }
+
+}   // namespace bench
+}   // namespace gedd
@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    UiBenchmarks.h
+    Created: 20 Oct 2026 3:12:40am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "BenchmarkRunner.h"
+
+namespace gedd
+{
+namespace bench
+{
+    struct UiSweep
+    {
+        std::vector<juce::Point<int>> sizes{ { 480, 300 }, { 960, 600 }, { 1920, 1200 } };
+        std::vector<float> scales{ 1.0f, 1.5f, 2.0f };
+        int numFrames{ 120 };
+    };
+
+    /*
+        The response display components drawn into offscreen images, no window is
+        opened. Each script changes something every frame, a parameter or a range,
+        for numFrames frames at every size and scale:
+
+            <component>::update     per frame, the change and the trace it causes
+            <component>::paint      per frame, drawing into the image
+
+        for VASVFTraceComponent, FrequencyDecibelGridOverlay and TraceAndGrid. The
+        "static" scripts change nothing, so paint is the cost of the caches alone.
+    */
+    void runUiBenchmarks(BenchmarkRunner& runner, const UiSweep& sweep);
+
+}   // namespace bench
+}   // namespace gedd
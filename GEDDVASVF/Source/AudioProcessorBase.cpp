@@ -15,10 +15,12 @@ gedd::AudioProcessorBase::AudioProcessorBase(const BusesProperties& ioLayouts, P
 	: AudioProcessor(ioLayouts),
     apvts(*this, um, "state", std::move(pl))
 {
+    addListener(this);
 }
 
 gedd::AudioProcessorBase::~AudioProcessorBase()
 {
+    removeListener(this);
 }
 
 //==============================================================================
@@ -86,17 +88,92 @@ void gedd::AudioProcessorBase::changeProgramName(int index, const juce::String&
 //==============================================================================
 void gedd::AudioProcessorBase::getStateInformation(juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
-    copyXmlToBinary(*apvts.copyState().createXml(), destData);
+    const juce::ScopedLock lock(stateLock);
+
+    // cleared first, a change while writing marks it again
+    if (stateDirty.exchange(false))
+        writeBinaryState(cachedState);
+
+    destData = cachedState;
 }
 
 void gedd::AudioProcessorBase::setStateInformation(const void* data, int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
-    apvts.replaceState(juce::ValueTree::fromXml(*getXmlFromBinary(data, sizeInBytes)));
+    const juce::ScopedLock lock(stateLock);
+
+    if (!readBinaryState(data, sizeInBytes))
+    {
+        // older sessions, the whole apvts as xml
+        if (auto xml = getXmlFromBinary(data, sizeInBytes))
+            apvts.replaceState(juce::ValueTree::fromXml(*xml));
+    }
+
+    markStateDirty();
+}
+
+void gedd::AudioProcessorBase::writeBinaryState(juce::MemoryBlock& destData)
+{
+    destData.reset();
+    juce::MemoryOutputStream stream(destData, false);
+
+    stream.writeInt(stateMagic);
+    stream.writeInt(stateVersion);
+
+    const auto& parameters = getParameters();
+    stream.writeCompressedInt(parameters.size());
+
+    for (auto* p : parameters)
+    {
+        auto* parameter = dynamic_cast<juce::RangedAudioParameter*>(p);
+        jassert(parameter != nullptr);
+
+        stream.writeString(parameter->paramID);
+        stream.writeFloat(parameter->convertFrom0to1(parameter->getValue()));
+    }
+
+    juce::ValueTree extra("extra");
+    writeExtraState(extra);
+    extra.writeToStream(stream);
+}
+
+bool gedd::AudioProcessorBase::readBinaryState(const void* data, int sizeInBytes)
+{
+    juce::MemoryInputStream stream(data, static_cast<size_t>(juce::jmax(0, sizeInBytes)), false);
+
+    if (stream.getTotalLength() < 8 || stream.readInt() != stateMagic)
+        return false;
+
+    const auto version = stream.readInt();
+
+    // from a newer build, leave everything as it is
+    if (version > stateVersion)
+    {
+        jassertfalse;
+        return true;
+    }
+
+    const auto numParameters = stream.readCompressedInt();
+
+    for (auto i = 0; i < numParameters && !stream.isExhausted(); ++i)
+    {
+        const auto id = stream.readString();
+        const auto value = stream.readFloat();
+
+        // parameters that no longer exist are skipped, new ones keep their defaults
+        if (auto* parameter = apvts.getParameter(id))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    if (!stream.isExhausted())
+        readExtraState(juce::ValueTree::readFromStream(stream));
+
+    return true;
+}
+
+void gedd::AudioProcessorBase::audioProcessorParameterChanged(juce::AudioProcessor*, int parameterIndex, float newValue)
+{
+    juce::ignoreUnused(parameterIndex, newValue);
+    markStateDirty();
 }
 
 //==============================================================================
@@ -157,6 +234,17 @@ bool gedd::AudioProcessorBase::isBusesLayoutSupported(const BusesLayout& layouts
         return false;
 #endif
 
+    // a sidechain, if there is one, can be disabled, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechain = layouts.getChannelSet(true, 1);
+
+        if (!sidechain.isDisabled()
+            && sidechain != juce::AudioChannelSet::mono()
+            && sidechain != juce::AudioChannelSet::stereo())
+            return false;
+    }
+
     return true;
 #endif
 }
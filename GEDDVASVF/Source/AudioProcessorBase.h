@@ -14,7 +14,8 @@
 
 namespace gedd {
 
-class AudioProcessorBase : public juce::AudioProcessor
+class AudioProcessorBase : public juce::AudioProcessor,
+                           private juce::AudioProcessorListener
 {
 public:
     //==============================================================================
@@ -58,6 +59,12 @@ public:
     void changeProgramName(int index, const juce::String& newName) override;
 
     //==============================================================================
+    /*
+        Binary state, a header then every parameter as id and value then the
+        subclass's extra state. The blob is cached and only rebuilt after something
+        changed, hosts that autosave every few seconds get a copy.
+        XML state from older sessions is still read.
+    */
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
@@ -73,9 +80,33 @@ public:
 
 protected:
     //==============================================================================
+    // non parameter state, written and read under the state lock
+    virtual void writeExtraState(juce::ValueTree& extra) { juce::ignoreUnused(extra); }
+    virtual void readExtraState(const juce::ValueTree& extra) { juce::ignoreUnused(extra); }
+
+    // call when anything writeExtraState() saves has changed, any thread
+    void markStateDirty() noexcept { stateDirty = true; }
+
+    const juce::CriticalSection& getStateLock() const noexcept { return stateLock; }
+
     juce::AudioProcessorValueTreeState apvts;
 
 private:
+    //==============================================================================
+    static constexpr int stateMagic{ 0x47454444 };      // "GEDD"
+    static constexpr int stateVersion{ 1 };
+
+    void writeBinaryState(juce::MemoryBlock& destData);
+    bool readBinaryState(const void* data, int sizeInBytes);
+
+    // AudioProcessorListener, may be called on the audio thread
+    void audioProcessorParameterChanged(juce::AudioProcessor*, int parameterIndex, float newValue) override;
+    void audioProcessorChanged(juce::AudioProcessor*) override {}
+
+    juce::CriticalSection stateLock;
+    juce::MemoryBlock cachedState;
+    std::atomic<bool> stateDirty{ true };
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioProcessorBase)
 };
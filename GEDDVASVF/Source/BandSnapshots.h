@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    BandSnapshots.h
+    Created: 19 Oct 2026 9:31:48pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "SeqLock.h"
+
+namespace gedd
+{
+    /*
+        Consistent per-band parameter sets for the audio thread.
+
+        Parameter listeners fire on whatever thread the host or editor uses, the
+        audio thread included, so writers never wait for each other. A writer
+        that finds another one publishing the same band only leaves a request
+        and returns. The publishing writer fills the snapshot after it has seen
+        the requests, and fills it again until none arrive while it does, so
+        the last change is always read after it was made and published last.
+        Each publish goes into the band's SeqLock and then sets its dirty bit.
+        The audio thread swaps the mask out and reads only the bands that changed.
+
+        A change landing after the swap sets its bit again and is picked up on
+        the next call, so nothing is lost. A band whose read loses a race with
+        its writer is re-flagged instead of being applied torn.
+    */
+    template <typename Snapshot, int maxBands = 1>
+    class BandSnapshots
+    {
+    public:
+        static_assert(maxBands > 0 && maxBands <= 32, "the dirty mask is 32 bits");
+
+        BandSnapshots() = default;
+
+        // any thread, fill(Snapshot&) reads the band's current values and may be called more than once
+        template <typename Fill>
+        void store(int band, Fill&& fill) noexcept
+        {
+            jassert(juce::isPositiveAndBelow(band, maxBands));
+
+            auto& requests = pending[static_cast<size_t>(band)];
+
+            // another writer is publishing this band and will fill it again for this change
+            if (requests.fetch_add(1, std::memory_order_acq_rel) != 0)
+                return;
+
+            auto seen = requests.load(std::memory_order_acquire);
+
+            for (;;)
+            {
+                Snapshot snapshot;
+                fill(snapshot);
+
+                bands[static_cast<size_t>(band)].store(snapshot);
+                dirty.fetch_or(1u << band, std::memory_order_release);
+
+                // a failed exchange leaves 'seen' holding the requests made while filling
+                if (requests.compare_exchange_strong(seen, 0, std::memory_order_acq_rel, std::memory_order_acquire))
+                    return;
+            }
+        }
+
+        // any thread, forces a band to be re-applied
+        void markDirty(int band) noexcept
+        {
+            jassert(juce::isPositiveAndBelow(band, maxBands));
+
+            dirty.fetch_or(1u << band, std::memory_order_release);
+        }
+
+        bool hasChanges() const noexcept { return dirty.load(std::memory_order_relaxed) != 0; }
+
+        // audio thread, calls fn(band, snapshot) once per changed band, returns the number applied
+        template <typename Fn>
+        int forEachChanged(Fn&& fn) noexcept
+        {
+            auto mask = dirty.exchange(0, std::memory_order_acquire);
+            auto numApplied = 0;
+
+            while (mask != 0)
+            {
+                const auto band = juce::findHighestSetBit(mask);
+                mask &= ~(1u << band);
+
+                Snapshot snapshot;
+
+                if (bands[static_cast<size_t>(band)].load(snapshot))
+                {
+                    fn(band, snapshot);
+                    ++numApplied;
+                }
+                else
+                {
+                    dirty.fetch_or(1u << band, std::memory_order_relaxed);
+                }
+            }
+
+            return numApplied;
+        }
+
+    private:
+        std::array<SeqLock<Snapshot>, static_cast<size_t>(maxBands)> bands;
+        std::array<std::atomic<juce::uint32>, static_cast<size_t>(maxBands)> pending{};
+        std::atomic<juce::uint32> dirty{ 0 };
+
+        JUCE_DECLARE_NON_COPYABLE(BandSnapshots)
+    };
+
+}   // namespace gedd
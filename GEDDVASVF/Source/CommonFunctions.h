@@ -18,6 +18,9 @@ namespace gedd
     {
         constexpr auto FrequencyDecibelGridOverlay  = 0x8800000;
         constexpr auto VASVFTraceComponent          = 0x8800100;
+        constexpr auto SpectrumAnalyserComponent    = 0x8800200;
+        constexpr auto MeasuredResponseComponent    = 0x8800300;
+        constexpr auto PresetBrowserComponent       = 0x8800400;
     }
 
     // Create a NormalisableRange of template type with frequency scaling
@@ -68,6 +71,23 @@ namespace gedd
         static constexpr FloatType reciprocalSqrt2 = static_cast<FloatType> (0.70710678118654752440L);
     };
 
+    // Background thread shared by the display components, use through a juce::SharedResourcePointer
+    struct DisplayThread : public juce::TimeSliceThread
+    {
+        DisplayThread() : juce::TimeSliceThread("GEDD Display") {}
+
+        ~DisplayThread() override { stopThread(1000); }
+
+        // message thread, started with the first client so components drawn offscreen never start it
+        void addClient(juce::TimeSliceClient* client)
+        {
+            addTimeSliceClient(client);
+
+            if (!isThreadRunning())
+                startThread(3);
+        }
+    };
+
     // gets the previous power of 2 to compliment juce::nextPowerOfTwo
     inline int lastPowerOfTwo(int n) noexcept
     {
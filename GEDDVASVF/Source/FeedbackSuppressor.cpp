@@ -0,0 +1,442 @@
+/*
+  ==============================================================================
+
+    FeedbackSuppressor.cpp
+    Created: 19 Oct 2026 3:32:10pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "FeedbackSuppressor.h"
+
+namespace gedd
+{
+namespace dsp
+{
+
+    template<typename SampleType>
+    FeedbackSuppressor<SampleType>::FeedbackSuppressor()
+    {
+        for (auto& n : notches)
+            n.state = new VASVF::State<SampleType>(1, 1, 1, 1, 0, 0);
+
+        for (auto i = 0; i != maxNotches; ++i)
+        {
+            publishedFrequencies[static_cast<size_t>(i)].store(0.0f);
+            publishedDepths[static_cast<size_t>(i)].store(0.0f);
+        }
+    }
+
+    template<typename SampleType>
+    FeedbackSuppressor<SampleType>::~FeedbackSuppressor()
+    {
+        release();
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::setEnabled(bool shouldBeEnabled) noexcept
+    {
+        if (shouldBeEnabled == enabled)
+            return;
+
+        enabled = shouldBeEnabled;
+
+        // let every notch ramp out, the pool is free again once they have
+        if (!enabled)
+        {
+            for (auto& n : notches)
+                n.depthTarget = 0;
+
+            return;
+        }
+
+        // peaks found before the suppressor was disabled are stale. This is the fifo's reading side,
+        // and the tag catches any detection the analysis thread is still writing from old input
+        generation.fetch_add(1, std::memory_order_release);
+        detectionFifo.finishedRead(detectionFifo.getNumReady());
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::setMaxNotches(int newMaxNotches) noexcept
+    {
+        jassert(juce::isPositiveAndNotGreaterThan(newMaxNotches, maxNotches));
+
+        numNotchesAllowed = juce::jlimit(0, maxNotches, newMaxNotches);
+
+        for (auto i = numNotchesAllowed; i < maxNotches; ++i)
+            notches[static_cast<size_t>(i)].depthTarget = 0;
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::setNotchQ(SampleType newQ) noexcept
+    {
+        jassert(newQ > 0);
+
+        // applies to notches placed from now on
+        notchQ = newQ;
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::setThreshold(float thresholdDecibels) noexcept
+    {
+        threshold.store(thresholdDecibels);
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::setPeakToAverage(float decibels) noexcept
+    {
+        jassert(decibels > 0.0f);
+
+        peakToAverage.store(decibels);
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::setHoldSeconds(double seconds) noexcept
+    {
+        jassert(seconds > 0.0);
+
+        holdSeconds = seconds;
+    }
+
+    template<typename SampleType>
+    float FeedbackSuppressor<SampleType>::getNotchFrequency(int index) const noexcept
+    {
+        jassert(juce::isPositiveAndBelow(index, maxNotches));
+
+        return publishedFrequencies[static_cast<size_t>(index)].load(std::memory_order_relaxed);
+    }
+
+    template<typename SampleType>
+    float FeedbackSuppressor<SampleType>::getNotchDepth(int index) const noexcept
+    {
+        jassert(juce::isPositiveAndBelow(index, maxNotches));
+
+        return publishedDepths[static_cast<size_t>(index)].load(std::memory_order_relaxed);
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+    {
+        jassert(spec.sampleRate > 0);
+        jassert(spec.numChannels > 0);
+
+        release();
+
+        sampleRate = spec.sampleRate;
+        numChannels = static_cast<int>(spec.numChannels);
+
+        filters.clear();
+        filters.reserve(static_cast<size_t>(maxNotches * numChannels));
+
+        for (auto& n : notches)
+            for (auto channel = 0; channel != numChannels; ++channel)
+                filters.emplace_back(n.state);
+
+        for (auto& f : filters)
+            f.prepare(spec);
+
+        inputBuffer.assign(static_cast<size_t>(inputFifo.getTotalSize()), 0.0f);
+
+        history.assign(static_cast<size_t>(fftSize), 0.0f);
+        fftData.assign(static_cast<size_t>(fftSize * 2), 0.0f);
+        levels.assign(static_cast<size_t>(fftSize / 2 + 1), -200.0f);
+        persistence.assign(levels.size(), 0);
+        lastPersistence.assign(levels.size(), 0);
+
+        // a full scale sine reads 0dB
+        levelScale = 4.0f / static_cast<float>(fftSize);
+
+        reset();
+
+        analysisThread.startThread(3);
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::reset() noexcept
+    {
+        for (auto& n : notches)
+        {
+            n.depth = 0;
+            n.depthTarget = 0;
+            n.samplesSinceConfirmed = 0;
+            n.state->data[static_cast<size_t>(4)] = 0;
+        }
+
+        for (auto& f : filters)
+            f.reset();
+
+        publishNotches();
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::release()
+    {
+        analysisThread.stopThread(1000);
+
+        inputFifo.reset();
+        detectionFifo.reset();
+
+        historyPosition = 0;
+        samplesSinceFrame = 0;
+        analysedGeneration = generation.load(std::memory_order_acquire);
+    }
+
+    //=========================================================================
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::handleDetections() noexcept
+    {
+        for (auto designs = 0; designs != maxDesignsPerBlock && detectionFifo.getNumReady() > 0; ++designs)
+        {
+            int start1, size1, start2, size2;
+            detectionFifo.prepareToRead(1, start1, size1, start2, size2);
+
+            const auto d = detections[static_cast<size_t>(start1)];
+
+            detectionFifo.finishedRead(1);
+
+            if (d.generation == generation.load(std::memory_order_relaxed))
+                assignNotch(d.frequency);
+        }
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::assignNotch(float frequency) noexcept
+    {
+        if (!juce::isPositiveAndBelow(static_cast<double>(frequency), sampleRate * 0.49))
+            return;
+
+        // a sixth of an octave either side counts as the same peak
+        const auto ratio = static_cast<SampleType>(1.122462048309373);
+
+        Notch* freeNotch = nullptr;
+        Notch* oldest = nullptr;
+
+        for (auto i = 0; i != numNotchesAllowed; ++i)
+        {
+            auto& n = notches[static_cast<size_t>(i)];
+
+            if (n.isRunning())
+            {
+                const auto f = static_cast<SampleType>(frequency);
+
+                if (f > n.frequency / ratio && f < n.frequency * ratio)
+                {
+                    n.samplesSinceConfirmed = 0;
+                    n.depthTarget = 1;
+                    return;
+                }
+
+                if (n.depthTarget > 0 && (oldest == nullptr || n.samplesSinceConfirmed > oldest->samplesSinceConfirmed))
+                    oldest = &n;
+            }
+            else if (freeNotch == nullptr)
+            {
+                freeNotch = &n;
+            }
+        }
+
+        if (freeNotch == nullptr)
+        {
+            // pool is full, release the stalest notch so the next detection finds a free slot
+            if (oldest != nullptr)
+                oldest->depthTarget = 0;
+
+            return;
+        }
+
+        // design at zero depth, it is ramped in from updateNotchDepth()
+        auto& n = *freeNotch;
+        n.frequency = static_cast<SampleType>(frequency);
+        *n.state = VASVF::State<SampleType>(VASVF::ArrayState<SampleType>::makeNotch(sampleRate, n.frequency, notchQ));
+        n.k = n.state->data[static_cast<size_t>(2)];
+        n.state->data[static_cast<size_t>(4)] = 0;
+        n.depth = 0;
+        n.depthTarget = 1;
+        n.samplesSinceConfirmed = 0;
+
+        const auto index = static_cast<int>(freeNotch - notches.data());
+
+        for (auto channel = 0; channel != numChannels; ++channel)
+            filters[static_cast<size_t>(index * numChannels + channel)].reset();
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::ageNotches(int numSamples) noexcept
+    {
+        const auto holdSamples = static_cast<int>(holdSeconds * sampleRate);
+
+        for (auto& n : notches)
+        {
+            if (n.depthTarget > 0)
+            {
+                n.samplesSinceConfirmed += numSamples;
+
+                if (n.samplesSinceConfirmed > holdSamples)
+                    n.depthTarget = 0;
+            }
+        }
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::updateNotchDepth(Notch& n) noexcept
+    {
+        if (n.depth != n.depthTarget)
+        {
+            const auto rampSeconds = n.depthTarget > n.depth ? rampInSeconds : rampOutSeconds;
+            const auto step = static_cast<SampleType>(static_cast<double>(controlInterval) / (rampSeconds * sampleRate));
+
+            n.depth = n.depthTarget > n.depth ? juce::jmin(n.depthTarget, n.depth + step)
+                                              : juce::jmax(n.depthTarget, n.depth - step);
+        }
+
+        // notch = v0 - k v1, so scaling m1 blends between dry and the full notch
+        n.state->data[static_cast<size_t>(4)] = -n.k * n.depth;
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::publishNotches() noexcept
+    {
+        auto active = 0;
+
+        for (auto i = 0; i != maxNotches; ++i)
+        {
+            const auto& n = notches[static_cast<size_t>(i)];
+            const auto running = n.isRunning();
+
+            active += running ? 1 : 0;
+
+            publishedFrequencies[static_cast<size_t>(i)].store(running ? static_cast<float>(n.frequency) : 0.0f, std::memory_order_relaxed);
+            publishedDepths[static_cast<size_t>(i)].store(static_cast<float>(n.depth), std::memory_order_relaxed);
+        }
+
+        numActive.store(active, std::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    template<typename SampleType>
+    bool FeedbackSuppressor<SampleType>::analyse()
+    {
+        const auto numReady = inputFifo.getNumReady();
+
+        if (numReady == 0)
+            return false;
+
+        // re-enabled, start from fresh input
+        const auto currentGeneration = generation.load(std::memory_order_acquire);
+
+        if (currentGeneration != analysedGeneration)
+        {
+            analysedGeneration = currentGeneration;
+
+            std::fill(history.begin(), history.end(), 0.0f);
+            std::fill(persistence.begin(), persistence.end(), 0);
+            std::fill(lastPersistence.begin(), lastPersistence.end(), 0);
+            historyPosition = 0;
+            samplesSinceFrame = 0;
+        }
+
+        int start1, size1, start2, size2;
+        inputFifo.prepareToRead(numReady, start1, size1, start2, size2);
+
+        auto read = [&](int start, int num)
+        {
+            for (auto i = 0; i != num; ++i)
+            {
+                history[static_cast<size_t>(historyPosition)] = inputBuffer[static_cast<size_t>(start + i)];
+                historyPosition = (historyPosition + 1) % fftSize;
+
+                if (++samplesSinceFrame == hopSize)
+                {
+                    samplesSinceFrame = 0;
+                    detectPeaks();
+                }
+            }
+        };
+
+        read(start1, size1);
+        read(start2, size2);
+
+        inputFifo.finishedRead(size1 + size2);
+
+        return true;
+    }
+
+    template<typename SampleType>
+    void FeedbackSuppressor<SampleType>::detectPeaks()
+    {
+        // unwrap the history, oldest sample first
+        for (auto i = 0; i != fftSize; ++i)
+            fftData[static_cast<size_t>(i)] = history[static_cast<size_t>((historyPosition + i) % fftSize)];
+
+        window.multiplyWithWindowingTable(fftData.data(), static_cast<size_t>(fftSize));
+        fft.performFrequencyOnlyForwardTransform(fftData.data());
+
+        const auto numBins = static_cast<int>(levels.size());
+
+        for (auto bin = 0; bin != numBins; ++bin)
+            levels[static_cast<size_t>(bin)] = juce::Decibels::gainToDecibels(fftData[static_cast<size_t>(bin)] * levelScale, -200.0f);
+
+        const auto binWidth = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
+        const auto minBin = juce::jmax(18, static_cast<int>(80.0f / binWidth));
+        const auto maxBin = juce::jmin(numBins - 18, static_cast<int>(16000.0f / binWidth));
+
+        const auto currentThreshold = threshold.load();
+        const auto currentPeakToAverage = peakToAverage.load();
+
+        std::swap(persistence, lastPersistence);
+        std::fill(persistence.begin(), persistence.end(), 0);
+
+        for (auto bin = minBin; bin < maxBin; ++bin)
+        {
+            const auto level = levels[static_cast<size_t>(bin)];
+
+            if (level < currentThreshold
+                || level < levels[static_cast<size_t>(bin - 1)]
+                || level < levels[static_cast<size_t>(bin + 1)])
+                continue;
+
+            // neighbourhood average, skipping the peak's own main lobe
+            auto sum = 0.0f;
+
+            for (auto offset = 3; offset <= 16; ++offset)
+                sum += levels[static_cast<size_t>(bin - offset)] + levels[static_cast<size_t>(bin + offset)];
+
+            if (level - sum / 28.0f < currentPeakToAverage)
+                continue;
+
+            // a howl drifts by at most a bin between frames
+            const auto count = 1 + juce::jmax(lastPersistence[static_cast<size_t>(bin - 1)],
+                                              lastPersistence[static_cast<size_t>(bin)],
+                                              lastPersistence[static_cast<size_t>(bin + 1)]);
+
+            // kept after a detection, so a peak that stays is reported every frame and its notch held
+            persistence[static_cast<size_t>(bin)] = juce::jmin(count, persistenceFrames);
+
+            if (count < persistenceFrames)
+                continue;
+
+            // parabolic interpolation on the dB levels
+            const auto a = levels[static_cast<size_t>(bin - 1)];
+            const auto c = levels[static_cast<size_t>(bin + 1)];
+            const auto denominator = a - 2.0f * level + c;
+            const auto offset = denominator < 0.0f ? 0.5f * (a - c) / denominator : 0.0f;
+
+            int start1, size1, start2, size2;
+            detectionFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+            // dropped if the audio thread has not caught up, the peak will be reported again
+            if (size1 == 1)
+            {
+                detections[static_cast<size_t>(start1)] = { (static_cast<float>(bin) + offset) * binWidth, level, analysedGeneration };
+                detectionFifo.finishedWrite(1);
+            }
+        }
+    }
+
+//=====================================
+template class FeedbackSuppressor<float>;
+template class FeedbackSuppressor<double>;
+
+}   // namespace dsp
+}   // namespace gedd
@@ -0,0 +1,292 @@
+/*
+  ==============================================================================
+
+    FeedbackSuppressor.h
+    Created: 19 Oct 2026 3:32:10pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "VASVF.h"
+
+namespace gedd
+{
+namespace dsp
+{
+    /*
+        Automatic feedback suppressor for live sound.
+
+        The input is handed to a background thread through a lock-free fifo, where
+        a short FFT peak tracker looks for narrow, persistent peaks that stand well
+        above their neighbourhood. Detections come back through a second lock-free
+        fifo and are placed on a pool of preallocated notch bands (State::makeNotch),
+        which are ramped in and released again once a peak has not been confirmed
+        for the hold time.
+
+        Audio thread cost is bounded: at most maxNotches multi-mono notches, only
+        active ones are processed, and at most maxDesignsPerBlock notches are
+        designed per block. The FFT never runs on the audio thread.
+    */
+    template<typename SampleType = float>
+    class FeedbackSuppressor
+    {
+    public:
+        static constexpr int maxNotches{ 12 };
+
+        FeedbackSuppressor();
+
+        ~FeedbackSuppressor();
+
+        // setters
+        void setEnabled(bool shouldBeEnabled) noexcept;
+
+        void setMaxNotches(int newMaxNotches) noexcept;
+
+        void setNotchQ(SampleType newQ) noexcept;
+
+        // absolute level a peak has to exceed
+        void setThreshold(float thresholdDecibels) noexcept;
+
+        // how far a peak has to stand above its neighbourhood
+        void setPeakToAverage(float decibels) noexcept;
+
+        void setHoldSeconds(double seconds) noexcept;
+
+        // getters
+        bool getEnabled() const noexcept { return enabled; }
+
+        int getMaxNotches() const noexcept { return numNotchesAllowed; }
+
+        SampleType getNotchQ() const noexcept { return notchQ; }
+
+        float getThreshold() const noexcept { return threshold.load(); }
+
+        float getPeakToAverage() const noexcept { return peakToAverage.load(); }
+
+        double getHoldSeconds() const noexcept { return holdSeconds; }
+
+        // safe from any thread
+        int getNumActiveNotches() const noexcept { return numActive.load(std::memory_order_relaxed); }
+
+        float getNotchFrequency(int index) const noexcept;
+
+        float getNotchDepth(int index) const noexcept;
+
+        // Dsp methods - prepare() (re)starts the analysis thread
+        void prepare(const juce::dsp::ProcessSpec& spec);
+
+        void reset() noexcept;
+
+        // stops the analysis thread
+        void release();
+
+        template<typename ProcessContext = juce::dsp::ProcessContextReplacing<float>>
+        void process(const ProcessContext& context) noexcept
+        {
+            const auto& inputBlock = context.getInputBlock();
+            auto& outputBlock = context.getOutputBlock();
+
+            jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+            jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
+            jassert(inputBlock.getNumChannels() <= static_cast<size_t>(numChannels));
+
+            if (context.usesSeparateInputAndOutputBlocks())
+                outputBlock.copyFrom(inputBlock);
+
+            if (context.isBypassed)
+                return;
+
+            const auto numSamples = outputBlock.getNumSamples();
+
+            if (enabled)
+            {
+                pushAnalysisSamples(inputBlock);
+                handleDetections();
+            }
+
+            ageNotches(static_cast<int>(numSamples));
+
+            for (auto index = 0; index != maxNotches; ++index)
+            {
+                auto& notch = notches[static_cast<size_t>(index)];
+
+                if (!notch.isRunning())
+                    continue;
+
+                for (size_t start = 0; start < numSamples; start += controlInterval)
+                {
+                    const auto num = juce::jmin(controlInterval, numSamples - start);
+
+                    updateNotchDepth(notch);
+
+                    auto subBlock = outputBlock.getSubBlock(start, num);
+
+                    for (size_t channel = 0; channel != subBlock.getNumChannels(); ++channel)
+                    {
+                        auto* data = subBlock.getChannelPointer(channel);
+                        auto& filter = filters[static_cast<size_t>(index * numChannels) + channel];
+
+                        for (size_t sample = 0; sample != num; ++sample)
+                            data[sample] = filter.processSample(data[sample]);
+
+#if JUCE_SNAP_TO_ZERO
+                        filter.snapToZero();
+#endif
+                    }
+                }
+            }
+
+            publishNotches();
+        }
+
+    private:
+        //=====================================================================
+        struct Detection
+        {
+            float frequency{ 0.0f };
+            float level{ 0.0f };
+            juce::uint32 generation{ 0 };
+        };
+
+        struct Notch
+        {
+            typename VASVF::State<SampleType>::Ptr state;
+            SampleType frequency{ 0 }, k{ 0 };
+            SampleType depth{ 0 }, depthTarget{ 0 };
+            int samplesSinceConfirmed{ 0 };
+
+            bool isRunning() const noexcept { return depth > 0 || depthTarget > 0; }
+        };
+
+        class AnalysisThread : public juce::Thread
+        {
+        public:
+            explicit AnalysisThread(FeedbackSuppressor& o) : juce::Thread("Feedback Analysis"), owner(o) {}
+
+            // sleeps until the audio thread has a hop of input, so a disabled suppressor never wakes it
+            void run() override
+            {
+                while (!threadShouldExit())
+                {
+                    if (!owner.analyse())
+                        wait(-1);
+                }
+            }
+
+        private:
+            FeedbackSuppressor& owner;
+        };
+
+        //=====================================================================
+        // audio thread
+        template<typename BlockType>
+        void pushAnalysisSamples(const BlockType& block) noexcept
+        {
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+            const auto numBlockChannels = block.getNumChannels();
+
+            if (numBlockChannels == 0)
+                return;
+
+            const auto scale = 1.0f / static_cast<float>(numBlockChannels);
+
+            int start1, size1, start2, size2;
+            inputFifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+            // the analysis thread catches up by dropping input when the fifo is full
+            auto write = [&](int destStart, int num, int sourceStart)
+            {
+                for (auto i = 0; i != num; ++i)
+                {
+                    auto sum = 0.0f;
+
+                    for (size_t channel = 0; channel != numBlockChannels; ++channel)
+                        sum += static_cast<float>(block.getSample(static_cast<int>(channel), sourceStart + i));
+
+                    inputBuffer[static_cast<size_t>(destStart + i)] = sum * scale;
+                }
+            };
+
+            write(start1, size1, 0);
+            write(start2, size2, size1);
+
+            inputFifo.finishedWrite(size1 + size2);
+
+            if (inputFifo.getNumReady() >= hopSize)
+                analysisThread.notify();
+        }
+
+        void handleDetections() noexcept;
+
+        void assignNotch(float frequency) noexcept;
+
+        void ageNotches(int numSamples) noexcept;
+
+        void updateNotchDepth(Notch& notch) noexcept;
+
+        void publishNotches() noexcept;
+
+        // analysis thread, returns false when there was nothing to do
+        bool analyse();
+
+        void detectPeaks();
+
+        //=====================================================================
+        static constexpr int fftOrder{ 10 };
+        static constexpr int fftSize{ 1 << fftOrder };
+        static constexpr int hopSize{ 256 };
+        static constexpr int persistenceFrames{ 8 };
+        static constexpr int maxDesignsPerBlock{ 2 };
+        static constexpr size_t controlInterval{ 32 };
+
+        double sampleRate{ 0.0 };
+        int numChannels{ 0 };
+
+        bool enabled{ false };
+        int numNotchesAllowed{ maxNotches };
+        SampleType notchQ{ 30 };
+        double holdSeconds{ 10.0 };
+        double rampInSeconds{ 0.05 }, rampOutSeconds{ 1.0 };
+
+        std::atomic<float> threshold{ -40.0f };
+
+        // bumped each time the suppressor is enabled, detections from before are dropped
+        std::atomic<juce::uint32> generation{ 0 };
+        std::atomic<float> peakToAverage{ 15.0f };
+
+        // notch pool, filters are [notch * numChannels + channel]
+        std::array<Notch, maxNotches> notches;
+        std::vector<VASVF::Filter<SampleType>> filters;
+
+        // audio -> analysis
+        juce::AbstractFifo inputFifo{ 8192 };
+        std::vector<float> inputBuffer;
+
+        // analysis -> audio
+        juce::AbstractFifo detectionFifo{ 32 };
+        std::array<Detection, 32> detections;
+
+        // analysis thread only
+        juce::dsp::FFT fft{ fftOrder };
+        juce::dsp::WindowingFunction<float> window{ static_cast<size_t>(fftSize), juce::dsp::WindowingFunction<float>::hann, false };
+        std::vector<float> history, fftData, levels;
+        std::vector<int> persistence, lastPersistence;
+        int historyPosition{ 0 }, samplesSinceFrame{ 0 };
+        juce::uint32 analysedGeneration{ 0 };
+        float levelScale{ 1.0f };
+
+        // published for the ui
+        std::array<std::atomic<float>, maxNotches> publishedFrequencies;
+        std::array<std::atomic<float>, maxNotches> publishedDepths;
+        std::atomic<int> numActive{ 0 };
+
+        AnalysisThread analysisThread{ *this };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FeedbackSuppressor)
+    };
+
+}   // namespace dsp
+}   // namespace gedd
@@ -17,13 +17,13 @@ FrequencyDecibelGridOverlay::FrequencyDecibelGridOverlay()
     textFont(juce::Font(juce::String("Microsoft YaHei UI"), 12.0f, juce::Font::bold))
 {
     setOpaque(false);   // needs to have transparent background
-    setBufferedToImage(true);
     setInterceptsMouseClicks(false, false);
     setPaintingIsUnclipped(true);
     setRepaintsOnMouseActivity(false);
 
     setColour(gridColourID, juce::Colours::darkslategrey);
     setColour(textColourID, juce::Colours::slategrey);
+    setColour(backgroundColourID, juce::Colours::transparentBlack);
 
     frequencyMarkers.makeDecades(frequencyRange);
 }
@@ -34,13 +34,13 @@ FrequencyDecibelGridOverlay::FrequencyDecibelGridOverlay(juce::NormalisableRange
     textFont(juce::Font(juce::String("Microsoft YaHei UI"), 12.0f, juce::Font::bold))
 {
     setOpaque(false);   // needs to have transparent background
-    setBufferedToImage(true);
     setInterceptsMouseClicks(false, false);
     setPaintingIsUnclipped(true);
     setRepaintsOnMouseActivity(false);
 
     setColour(gridColourID, juce::Colours::darkslategrey);
     setColour(textColourID, juce::Colours::slategrey);
+    setColour(backgroundColourID, juce::Colours::transparentBlack);
 
     frequencyMarkers.makeDecades(frequencyRange);
 }
@@ -60,6 +60,8 @@ void FrequencyDecibelGridOverlay::setFrequencyRange(juce::Range<double> r)
         frequencyRange.end = r.getEnd();
 
         frequencyMarkers.makeDecades(r);
+
+        invalidateGrid();
     }
 }
 
@@ -71,7 +73,7 @@ void FrequencyDecibelGridOverlay::setFrequencyNormalisableRange(juce::Normalisab
 
     frequencyMarkers.makeDecades(r.getRange());
 
-    repaint();
+    invalidateGrid();
 }
 
 void FrequencyDecibelGridOverlay::setDecibelRange(double bottom, double top)
@@ -87,6 +89,8 @@ void FrequencyDecibelGridOverlay::setDecibelRange(juce::Range<double> r)
     {
         decibelRange.start = r.getStart();
         decibelRange.end = r.getEnd();
+
+        invalidateGrid();
     }
 }
 
@@ -95,26 +99,86 @@ void FrequencyDecibelGridOverlay::setDecibelNormalisableRange(juce::Normalisable
     if (r.getRange().getLength() <= 0) return;
 
     decibelRange = r;
-    repaint();
+    invalidateGrid();
+}
+
+void FrequencyDecibelGridOverlay::setFont(juce::Font f)
+{
+    textFont = f;
+    invalidateGrid();
 }
 
 void FrequencyDecibelGridOverlay::setGridThicknessPx(int t)
 {
     jassert(t > 0); 
     gridThicknessPx = t;
+    invalidateGrid();
 }
 
 void FrequencyDecibelGridOverlay::paint(juce::Graphics& g)
 {
-    paintFrequencyGrid(g);
-    paintDecibelGrid(g);
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (gridNeedsRebuild || scale != imageScale)
+        renderGrid(scale);
+
+    g.drawImageTransformed(gridImage, juce::AffineTransform::scale(1.0f / imageScale));
 }
 
 void FrequencyDecibelGridOverlay::resized()
 {
+    invalidateGrid();
+}
+
+void FrequencyDecibelGridOverlay::colourChanged()
+{
+    // an opaque background lets JUCE skip whatever is behind the grid
+    setOpaque(findColour(backgroundColourID).isOpaque());
+    invalidateGrid();
+}
+
+void FrequencyDecibelGridOverlay::invalidateGrid()
+{
+    gridNeedsRebuild = true;
     repaint();
 }
 
+void FrequencyDecibelGridOverlay::renderGrid(float scale)
+{
+    jassert(scale > 0.0f);
+
+    gridNeedsRebuild = false;
+    imageScale = scale;
+
+    const auto width = juce::jmax(1, juce::roundToInt(static_cast<float>(getWidth()) * scale));
+    const auto height = juce::jmax(1, juce::roundToInt(static_cast<float>(getHeight()) * scale));
+
+    if (gridImage.isNull() || gridImage.getWidth() != width || gridImage.getHeight() != height)
+        gridImage = juce::Image(juce::Image::ARGB, width, height, true);
+    else
+        gridImage.clear(gridImage.getBounds());
+
+    juce::Graphics g(gridImage);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
+    g.fillAll(findColour(backgroundColourID));
+
+    paintFrequencyGrid(g);
+    paintDecibelGrid(g);
+}
+
+const char* FrequencyDecibelGridOverlay::getDecadeLabel(int marker) noexcept
+{
+    switch (marker)
+    {
+    case 10:    return "10";
+    case 100:   return "100";
+    case 1000:  return "1k";
+    case 10000: return "10k";
+    default:    return nullptr;
+    }
+}
+
 void FrequencyDecibelGridOverlay::paintFrequencyGrid(juce::Graphics& g)
 {
     const auto bounds = getLocalBounds();
@@ -136,13 +200,8 @@ void FrequencyDecibelGridOverlay::paintFrequencyGrid(juce::Graphics& g)
         g.setColour(findColour(textColourID));
         g.setFont(textFont);
 
-        switch (marker)
-        {
-        case 10:    drawFrequencyLabels(g, juce::StringArray(decadeStrings)[0], xPos, textBaseLine); break;
-        case 100:   drawFrequencyLabels(g, juce::StringArray(decadeStrings)[1], xPos, textBaseLine); break;
-        case 1000:  drawFrequencyLabels(g, juce::StringArray(decadeStrings)[2], xPos, textBaseLine); break;
-        case 10000: drawFrequencyLabels(g, juce::StringArray(decadeStrings)[3], xPos, textBaseLine); break;
-        }
+        if (auto* label = getDecadeLabel(marker))
+            drawFrequencyLabels(g, label, xPos, textBaseLine);
     }
 }
 
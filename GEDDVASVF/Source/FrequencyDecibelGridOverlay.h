@@ -15,6 +15,10 @@
 
 //==============================================================================
 /*
+* Grid and labels are rendered once into a cached image at the physical pixel scale,
+* and only rebuilt when the ranges, size, font, colours or scale change. Give it an
+* opaque background colour and components on top can repaint without touching it.
+*
 * Bugs: - db lines should always centre around 0
 */
 class FrequencyDecibelGridOverlay : public juce::Component
@@ -90,8 +94,9 @@ public:
 
     enum ColourIDs
     {
-        gridColourID = 0x8800000,
-        textColourID = 0x8800001
+        gridColourID        = 0x8800000,
+        textColourID        = 0x8800001,
+        backgroundColourID  = 0x8800002
     };
 
     FrequencyDecibelGridOverlay();
@@ -111,7 +116,7 @@ public:
 
     void setDecibelNormalisableRange(juce::NormalisableRange<double> r);
 
-    void setFont(juce::Font f) { textFont = f; }
+    void setFont(juce::Font f);
 
     void setGridThicknessPx(int t);
 
@@ -132,7 +137,13 @@ public:
 
     void resized() override;
 
+    void colourChanged() override;
+
 private:
+    void invalidateGrid();
+
+    void renderGrid(float scale);
+
     void paintFrequencyGrid(juce::Graphics& g);
 
     void drawFrequencyLabels(juce::Graphics& g, juce::StringRef str, const double y, const double textBase);
@@ -141,7 +152,8 @@ private:
 
     void paintDecibelGrid(juce::Graphics& g);
 
-    static constexpr auto decadeStrings = { "10", "100", "1k", "10k" };
+    // label for a decade marker, nullptr for the markers in between
+    static const char* getDecadeLabel(int marker) noexcept;
 
     FrequencyMarkers frequencyMarkers;
 
@@ -152,6 +164,10 @@ private:
     juce::NormalisableRange<double> frequencyRange;
     juce::NormalisableRange<double> decibelRange;
 
+    juce::Image gridImage;
+    float imageScale{ 0.0f };
+    bool gridNeedsRebuild{ true };
+
     //========================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrequencyDecibelGridOverlay)
 };
@@ -0,0 +1,230 @@
+/*
+  ==============================================================================
+
+    MeasuredResponseComponent.cpp
+    Created: 19 Oct 2026 9:02:15pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "MeasuredResponseComponent.h"
+
+//==============================================================================
+MeasuredResponseComponent::MeasuredResponseComponent()
+{
+    setOpaque(false);
+    setInterceptsMouseClicks(false, false);
+    setPaintingIsUnclipped(true);
+    setRepaintsOnMouseActivity(false);
+
+    setColour(measuredMagnitudeColourID, juce::Colours::orange);
+    setColour(measuredPhaseColourID, juce::Colours::orange.withAlpha(0.6f));
+
+    // the display thread is only used once there is an analyser
+    startTimerHz(maxFrameRate.load());
+}
+
+MeasuredResponseComponent::~MeasuredResponseComponent()
+{
+    // waits for an analysis in progress
+    displayThread->removeTimeSliceClient(this);
+
+    if (analyser != nullptr)
+        analyser->setActive(false);
+}
+
+void MeasuredResponseComponent::paint(juce::Graphics& g)
+{
+    if (!measuring)
+        return;
+
+    const auto& paths = results.getReadBuffer();
+
+    if (showPhase && !paths.phase.isEmpty())
+    {
+        g.setColour(findColour(measuredPhaseColourID));
+        g.strokePath(paths.phase, juce::PathStrokeType(1.0f));
+    }
+
+    if (showMagnitude && !paths.magnitude.isEmpty())
+    {
+        g.setColour(findColour(measuredMagnitudeColourID));
+        g.strokePath(paths.magnitude, juce::PathStrokeType(1.0f));
+    }
+}
+
+void MeasuredResponseComponent::resized()
+{
+    postRequest();
+}
+
+void MeasuredResponseComponent::setAnalyser(gedd::dsp::TransferFunctionAnalyser* newAnalyser)
+{
+    // swapped while the display thread can't be using it
+    displayThread->removeTimeSliceClient(this);
+
+    if (analyser != nullptr && analyser != newAnalyser)
+        analyser->setActive(false);
+
+    analyser = newAnalyser;
+
+    if (analyser != nullptr)
+    {
+        analyser->setActive(measuring);
+        displayThread->addClient(this);
+    }
+}
+
+void MeasuredResponseComponent::setMeasuring(bool shouldMeasure)
+{
+    measuring = shouldMeasure;
+
+    // costs the audio thread nothing while off, and restarts the averages when turned on
+    if (analyser != nullptr)
+        analyser->setActive(measuring);
+
+    repaint();
+}
+
+void MeasuredResponseComponent::setShowMagnitude(bool shouldShow)
+{
+    showMagnitude = shouldShow;
+    repaint();
+}
+
+void MeasuredResponseComponent::setShowPhase(bool shouldShow)
+{
+    showPhase = shouldShow;
+    repaint();
+}
+
+void MeasuredResponseComponent::setCoherenceThreshold(float newThreshold)
+{
+    jassert(newThreshold >= 0.0f && newThreshold <= 1.0f);
+
+    coherenceThreshold = newThreshold;
+    postRequest();
+}
+
+void MeasuredResponseComponent::setFrequencyNormalisableRange(juce::NormalisableRange<double> r)
+{
+    if (r.getRange().getLength() <= 0) return;
+
+    frequencyRange = r;
+    postRequest();
+}
+
+void MeasuredResponseComponent::setDecibelNormalisableRange(juce::NormalisableRange<double> r)
+{
+    if (r.getRange().getLength() <= 0) return;
+
+    decibelRange = r;
+    postRequest();
+}
+
+void MeasuredResponseComponent::setMaxFrameRate(int framesPerSecond)
+{
+    jassert(framesPerSecond > 0);
+
+    maxFrameRate = framesPerSecond;
+    startTimerHz(framesPerSecond);
+}
+
+void MeasuredResponseComponent::postRequest()
+{
+    auto& r = requests.getWriteBuffer();
+
+    r.frequencyRange = frequencyRange;
+    r.decibelRange = decibelRange;
+    r.bounds = getLocalBounds();
+    r.coherenceThreshold = coherenceThreshold;
+
+    requests.publish();
+}
+
+void MeasuredResponseComponent::timerCallback()
+{
+    if (results.acquire())
+        repaint();
+}
+
+//==============================================================================
+int MeasuredResponseComponent::useTimeSlice()
+{
+    const auto frameMilliseconds = 1000 / maxFrameRate.load();
+
+    const auto requestChanged = requests.acquire();
+
+    if (requestChanged)
+        request = requests.getReadBuffer();
+
+    if (analyser == nullptr)
+        return frameMilliseconds;
+
+    const auto measurementChanged = analyser->analyse();
+
+    if (request.bounds.getWidth() < 2 || request.bounds.getHeight() < 1)
+        return frameMilliseconds;
+
+    if (!requestChanged && !measurementChanged)
+        return frameMilliseconds;
+
+    createPaths(results.getWriteBuffer());
+    results.publish();
+
+    return frameMilliseconds;
+}
+
+void MeasuredResponseComponent::createPaths(MeasurementPaths& paths)
+{
+    // one point every other pixel, the same mapping as VASVFTraceComponent
+    const auto bounds = request.bounds.toDouble();
+    const auto numPoints = juce::jmax(2, request.bounds.getWidth() / 2);
+    const auto num = static_cast<size_t>(numPoints);
+
+    magnitudes.resize(num);
+    phases.resize(num);
+    coherence.resize(num);
+
+    analyser->getResponse(request.frequencyRange, magnitudes.data(), phases.data(), coherence.data(), numPoints);
+
+    const auto xScale = bounds.getWidth() / static_cast<double>(numPoints - 1);
+
+    paths.magnitude.clear();
+    paths.phase.clear();
+    paths.magnitude.preallocateSpace(3 * numPoints);
+    paths.phase.preallocateSpace(3 * numPoints);
+
+    // unreliable points break both paths
+    auto startNew = true;
+
+    for (size_t i = 0; i != num; ++i)
+    {
+        if (coherence[i] < request.coherenceThreshold)
+        {
+            startNew = true;
+            continue;
+        }
+
+        const auto xPos = static_cast<float>(bounds.getX() + static_cast<double>(i) * xScale);
+
+        const auto db = request.decibelRange.convertTo0to1(request.decibelRange.snapToLegalValue(juce::Decibels::gainToDecibels(static_cast<double>(magnitudes[i]))));
+        const auto magnitudeY = static_cast<float>(bounds.getHeight() - ((db * bounds.getHeight()) + bounds.getY()));
+
+        const auto phase = static_cast<double>(phases[i]) * gedd::MathConstants<double>::reciprocalTwopi;
+        const auto phaseY = static_cast<float>(bounds.getCentreY() - ((phase * bounds.getHeight()) + bounds.getY()));
+
+        if (startNew)
+        {
+            paths.magnitude.startNewSubPath(xPos, magnitudeY);
+            paths.phase.startNewSubPath(xPos, phaseY);
+            startNew = false;
+        }
+        else
+        {
+            paths.magnitude.lineTo(xPos, magnitudeY);
+            paths.phase.lineTo(xPos, phaseY);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    MeasuredResponseComponent.h
+    Created: 19 Oct 2026 9:02:15pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "TransferFunctionAnalyser.h"
+#include "CommonFunctions.h"
+#include "TripleBuffer.h"
+
+//==============================================================================
+/*
+* The transfer function measured from the running audio, drawn over the predicted
+* trace with the same scales so the two can be compared directly.
+*
+* Frequencies where the coherence falls below the threshold, because there was
+* too little input there or the filter was moving, are left out of the paths.
+*/
+class MeasuredResponseComponent : public juce::Component,
+                                  private juce::Timer,
+                                  private juce::TimeSliceClient
+{
+public:
+    enum ColourIDs
+    {
+        measuredMagnitudeColourID   = 0x8800300,
+        measuredPhaseColourID       = 0x8800301
+    };
+
+    MeasuredResponseComponent();
+
+    ~MeasuredResponseComponent() override;
+
+    void paint(juce::Graphics& g) override;
+
+    void resized() override;
+
+    // may be nullptr, it is active while measuring and has to outlive this component
+    void setAnalyser(gedd::dsp::TransferFunctionAnalyser* newAnalyser);
+
+    // setters
+    void setMeasuring(bool shouldMeasure);
+
+    void setShowMagnitude(bool shouldShow);
+
+    void setShowPhase(bool shouldShow);
+
+    void setCoherenceThreshold(float newThreshold);
+
+    void setFrequencyNormalisableRange(juce::NormalisableRange<double> r);
+
+    void setDecibelNormalisableRange(juce::NormalisableRange<double> r);
+
+    void setMaxFrameRate(int framesPerSecond);
+
+    // getters
+    bool isMeasuring() const { return measuring; }
+
+    bool getShowMagnitude() const { return showMagnitude; }
+
+    bool getShowPhase() const { return showPhase; }
+
+    float getCoherenceThreshold() const { return coherenceThreshold; }
+
+    int getMaxFrameRate() const { return maxFrameRate.load(); }
+
+private:
+    struct MeasurementRequest
+    {
+        juce::NormalisableRange<double> frequencyRange;
+        juce::NormalisableRange<double> decibelRange;
+        juce::Rectangle<int> bounds;
+        float coherenceThreshold{ 0.0f };
+    };
+
+    struct MeasurementPaths
+    {
+        juce::Path magnitude, phase;
+    };
+
+    // message thread
+    void postRequest();
+
+    void timerCallback() override;
+
+    // display thread
+    int useTimeSlice() override;
+
+    void createPaths(MeasurementPaths& paths);
+
+    //============================================================
+    juce::NormalisableRange<double> frequencyRange{ gedd::createFrequencyRange(20.0, 18000.0) };
+    juce::NormalisableRange<double> decibelRange{ -24.0, 24.0 };
+    float coherenceThreshold{ 0.8f };
+
+    bool measuring{ false };
+    bool showMagnitude{ true };
+    bool showPhase{ true };
+    std::atomic<int> maxFrameRate{ 30 };
+
+    gedd::dsp::TransferFunctionAnalyser* analyser{ nullptr };
+
+    // message thread -> display thread
+    gedd::TripleBuffer<MeasurementRequest> requests;
+
+    // display thread -> message thread
+    gedd::TripleBuffer<MeasurementPaths> results;
+
+    // display thread only
+    MeasurementRequest request;
+    std::vector<float> magnitudes, phases, coherence;
+
+    juce::SharedResourcePointer<gedd::DisplayThread> displayThread;
+
+    //============================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MeasuredResponseComponent)
+};
@@ -33,6 +33,15 @@ namespace ID
         static constexpr auto gain  = "gain";
         static constexpr auto q     = "q";
         static constexpr auto autoq = "autoq";
+        static constexpr auto morph = "morph";
+        static constexpr auto dynamic   = "dynamic";
+        static constexpr auto sidechain = "sidechain";
+        static constexpr auto threshold = "threshold";
+        static constexpr auto ratio     = "ratio";
+        static constexpr auto attack    = "attack";
+        static constexpr auto release   = "release";
+        static constexpr auto suppressor = "suppressor";
+        static constexpr auto smoothing = "smoothing";
     }
 }
 
@@ -52,11 +61,29 @@ struct EQParameterReference
         gainID  (name + ID::EQ::gain),
         qID     (name + ID::EQ::q),
         autoqID (name + ID::EQ::autoq),
+        morphID (name + ID::EQ::morph),
+        dynamicID   (name + ID::EQ::dynamic),
+        sidechainID (name + ID::EQ::sidechain),
+        thresholdID (name + ID::EQ::threshold),
+        ratioID     (name + ID::EQ::ratio),
+        attackID    (name + ID::EQ::attack),
+        releaseID   (name + ID::EQ::release),
+        suppressorID(name + ID::EQ::suppressor),
+        smoothingID (name + ID::EQ::smoothing),
         type    (static_cast<ParameterChoice&>(*apvts.getParameter(typeID))),
         freq    (static_cast<ParameterFloat&> (*apvts.getParameter(freqID))),
         gain    (static_cast<ParameterFloat&> (*apvts.getParameter(gainID))),
         q       (static_cast<ParameterFloat&> (*apvts.getParameter(qID))),
-        autoq   (static_cast<ParameterBool&>(*apvts.getParameter(autoqID)))
+        autoq   (static_cast<ParameterBool&>(*apvts.getParameter(autoqID))),
+        morph   (static_cast<ParameterFloat&>(*apvts.getParameter(morphID))),
+        dynamic     (static_cast<ParameterBool&> (*apvts.getParameter(dynamicID))),
+        sidechain   (static_cast<ParameterBool&> (*apvts.getParameter(sidechainID))),
+        threshold   (static_cast<ParameterFloat&>(*apvts.getParameter(thresholdID))),
+        ratio       (static_cast<ParameterFloat&>(*apvts.getParameter(ratioID))),
+        attack      (static_cast<ParameterFloat&>(*apvts.getParameter(attackID))),
+        release     (static_cast<ParameterFloat&>(*apvts.getParameter(releaseID))),
+        suppressor  (static_cast<ParameterBool&> (*apvts.getParameter(suppressorID))),
+        smoothing   (static_cast<ParameterFloat&>(*apvts.getParameter(smoothingID)))
     {}
 
     // id
@@ -65,6 +92,15 @@ struct EQParameterReference
     juce::Identifier freqID;
     juce::Identifier gainID;
     juce::Identifier qID;
+    juce::Identifier morphID;
+    juce::Identifier dynamicID;
+    juce::Identifier sidechainID;
+    juce::Identifier thresholdID;
+    juce::Identifier ratioID;
+    juce::Identifier attackID;
+    juce::Identifier releaseID;
+    juce::Identifier suppressorID;
+    juce::Identifier smoothingID;
 
     // params
     ParameterBool& autoq;
@@ -72,6 +108,21 @@ struct EQParameterReference
     ParameterFloat& freq;
     ParameterFloat& gain;
     ParameterFloat& q;
+    ParameterFloat& morph;
+
+    // dynamic eq params
+    ParameterBool& dynamic;
+    ParameterBool& sidechain;
+    ParameterFloat& threshold;
+    ParameterFloat& ratio;
+    ParameterFloat& attack;
+    ParameterFloat& release;
+
+    // automatic feedback suppression
+    ParameterBool& suppressor;
+
+    // parameter ramp time, applied on the audio thread
+    ParameterFloat& smoothing;
 
     // parameter group builder
     static std::vector<std::unique_ptr<ParameterGroup>> createParamGroup(juce::StringRef name)
@@ -116,6 +167,75 @@ struct EQParameterReference
             ID::EQ::autoq,
             false);
 
+        auto morph = std::make_unique<ParameterFloat>(
+            name + ID::EQ::morph,
+            ID::EQ::morph,
+            "",
+            juce::NormalisableRange<float>(0.0f, 4.0f),
+            0.0f,
+            gedd::floatValueToTextFunction,
+            gedd::floatTextToValueFunction);
+
+        auto dynamic = std::make_unique<ParameterBool>(
+            name + ID::EQ::dynamic,
+            ID::EQ::dynamic,
+            false);
+
+        auto sidechain = std::make_unique<ParameterBool>(
+            name + ID::EQ::sidechain,
+            ID::EQ::sidechain,
+            false);
+
+        auto threshold = std::make_unique<ParameterFloat>(
+            name + ID::EQ::threshold,
+            ID::EQ::threshold,
+            "dB",
+            juce::NormalisableRange<float>(-60.0f, 0.0f),
+            -18.0f,
+            gedd::floatValueToTextFunction,
+            gedd::floatTextToValueFunction);
+
+        auto ratio = std::make_unique<ParameterFloat>(
+            name + ID::EQ::ratio,
+            ID::EQ::ratio,
+            ": 1",
+            juce::NormalisableRange<float>(0.25f, 20.0f, 0.0f, 0.333f),
+            2.0f,
+            gedd::floatValueToTextFunction,
+            gedd::floatTextToValueFunction);
+
+        auto attack = std::make_unique<ParameterFloat>(
+            name + ID::EQ::attack,
+            ID::EQ::attack,
+            "ms",
+            juce::NormalisableRange<float>(0.1f, 200.0f, 0.0f, 0.333f),
+            10.0f,
+            gedd::floatValueToTextFunction,
+            gedd::floatTextToValueFunction);
+
+        auto release = std::make_unique<ParameterFloat>(
+            name + ID::EQ::release,
+            ID::EQ::release,
+            "ms",
+            juce::NormalisableRange<float>(1.0f, 2000.0f, 0.0f, 0.333f),
+            100.0f,
+            gedd::floatValueToTextFunction,
+            gedd::floatTextToValueFunction);
+
+        auto suppressor = std::make_unique<ParameterBool>(
+            name + ID::EQ::suppressor,
+            ID::EQ::suppressor,
+            false);
+
+        auto smoothing = std::make_unique<ParameterFloat>(
+            name + ID::EQ::smoothing,
+            ID::EQ::smoothing,
+            "s",
+            juce::NormalisableRange<float>(0.001f, 1.0f, 0.0f, 0.333f),
+            0.05f,
+            gedd::floatValueToTextFunction,
+            gedd::floatTextToValueFunction);
+
         params.push_back(std::make_unique<ParameterGroup>(
             name,
             name,
@@ -124,7 +244,16 @@ struct EQParameterReference
             std::move(freq),
             std::move(gain),
             std::move(q),
-            std::move(autoq)
+            std::move(autoq),
+            std::move(morph),
+            std::move(dynamic),
+            std::move(sidechain),
+            std::move(threshold),
+            std::move(ratio),
+            std::move(attack),
+            std::move(release),
+            std::move(suppressor),
+            std::move(smoothing)
             ));
 
         return params;
@@ -15,33 +15,65 @@ GeddvasvfAudioProcessorEditor::GeddvasvfAudioProcessorEditor (GeddvasvfAudioProc
     freqSlider(p.getParameterReferences().eqParamRef.freq),
     qSlider(p.getParameterReferences().eqParamRef.q),
     gainSlider(p.getParameterReferences().eqParamRef.gain),
+    morphSlider(p.getParameterReferences().eqParamRef.morph),
     filterTypeCombo(p.getParameterReferences().eqParamRef.type),
     autoqToggle(p.getParameterReferences().eqParamRef.autoq),
-    responseTrace(p.getParameterReferences().eqParamRef)
+    suppressorToggle(p.getParameterReferences().eqParamRef.suppressor),
+    responseTrace(p.getParameterReferences().eqParamRef),
+    dynamicToggle(p.getParameterReferences().eqParamRef.dynamic),
+    sidechainToggle(p.getParameterReferences().eqParamRef.sidechain),
+    thresholdSlider(p.getParameterReferences().eqParamRef.threshold),
+    ratioSlider(p.getParameterReferences().eqParamRef.ratio),
+    attackSlider(p.getParameterReferences().eqParamRef.attack),
+    releaseSlider(p.getParameterReferences().eqParamRef.release),
+    smoothingSlider(p.getParameterReferences().eqParamRef.smoothing),
+    presetStrip(p.getPresetSlotsRef()),
+    presetBrowser(p.getPresetSlotsRef())
 {
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
-    setSize (800, 400);
+    setSize (1440, 440);
 
     addAndMakeVisible(filterTypeCombo);
     addAndMakeVisible(freqSlider);
     addAndMakeVisible(qSlider);
     addAndMakeVisible(gainSlider);
+    addAndMakeVisible(morphSlider);
     addAndMakeVisible(autoqToggle);
+    addAndMakeVisible(suppressorToggle);
     addAndMakeVisible(responseTrace);
-    addAndMakeVisible(parameterSmoothingSlider);
-
-    parameterSmoothingSliderLabel.attachToComponent(&parameterSmoothingSlider, false);
-    parameterSmoothingSlider.setSliderStyle(juce::Slider::SliderStyle::LinearVertical);
-    parameterSmoothingSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 80, 30);
-    parameterSmoothingSlider.setTextValueSuffix(" s");
-    parameterSmoothingSlider.setRange(juce::Range<double>(0.001, 1.0), 0.0);
-    parameterSmoothingSlider.setNumDecimalPlacesToDisplay(3);
-    parameterSmoothingSlider.setValue(audioProcessor.getSvfProcessorRef().getRampDurationSeconds());
-
-    parameterSmoothingSlider.onValueChange = [&] {
-        audioProcessor.getSvfProcessorRef().setRampDurationSeconds(parameterSmoothingSlider.getValue());
+    addAndMakeVisible(smoothingSlider);
+    addAndMakeVisible(dynamicToggle);
+    addAndMakeVisible(sidechainToggle);
+    addAndMakeVisible(thresholdSlider);
+    addAndMakeVisible(ratioSlider);
+    addAndMakeVisible(attackSlider);
+    addAndMakeVisible(releaseSlider);
+    addAndMakeVisible(presetStrip);
+    addAndMakeVisible(presetBrowser);
+
+    responseTrace.setStateSource(&audioProcessor.getSvfProcessorRef().getStateSnapshot());
+    responseTrace.setAnalysers(&audioProcessor.getPreAnalyserRef(), &audioProcessor.getPostAnalyserRef());
+    responseTrace.setTransferFunctionAnalyser(&audioProcessor.getTransferFunctionAnalyserRef());
+
+    // the view is saved with the plugin state
+    const auto ranges = audioProcessor.getTraceRanges();
+    responseTrace.setRanges(ranges.frequency, ranges.decibels);
+
+    responseTrace.onRangesChanged = [this] {
+        GeddvasvfAudioProcessor::TraceRanges r;
+        r.frequency = responseTrace.getFrequencyRange();
+        r.decibels = responseTrace.getDecibelRange();
+
+        audioProcessor.setTraceRanges(r);
     };
+
+    const auto libraryFile = audioProcessor.getPresetLibraryFile();
+
+    if (libraryFile.existsAsFile())
+        presetBrowser.openLibrary(libraryFile);
+
+    presetBrowser.onLibraryChanged = [this](const juce::File& file) { audioProcessor.setPresetLibraryFile(file); };
 }
 
 GeddvasvfAudioProcessorEditor::~GeddvasvfAudioProcessorEditor()
@@ -60,19 +92,37 @@ void GeddvasvfAudioProcessorEditor::resized()
     const auto sliderWidth = 80;
     const auto comboHeight = 60;
     const auto comboWidth = 160;
+    const auto presetStripHeight = 40;
+    const auto presetBrowserWidth = 240;
 
     auto bounds = getLocalBounds();
-    auto controlRegion = bounds.removeFromLeft(sliderWidth * 4);
+    presetBrowser.setBounds(bounds.removeFromRight(presetBrowserWidth));
+    presetStrip.setBounds(bounds.removeFromBottom(presetStripHeight));
+
+    auto controlRegion = bounds.removeFromLeft(sliderWidth * 5);
     auto controlTopBar = controlRegion.removeFromTop(comboHeight);
 
     filterTypeCombo.setBounds(controlTopBar.removeFromLeft(comboWidth));
-    autoqToggle.setBounds(controlTopBar);
+    autoqToggle.setBounds(controlTopBar.removeFromLeft(controlTopBar.getWidth() / 2));
+    suppressorToggle.setBounds(controlTopBar);
 
     freqSlider.setBounds(controlRegion.removeFromLeft(sliderWidth));
     qSlider.setBounds(controlRegion.removeFromLeft(sliderWidth));
     gainSlider.setBounds(controlRegion.removeFromLeft(sliderWidth));
+    morphSlider.setBounds(controlRegion.removeFromLeft(sliderWidth));
+
+    smoothingSlider.setBounds(controlRegion);
+
+    auto dynamicsRegion = bounds.removeFromRight(sliderWidth * 4);
+    auto dynamicsTopBar = dynamicsRegion.removeFromTop(comboHeight);
+
+    dynamicToggle.setBounds(dynamicsTopBar.removeFromLeft(dynamicsTopBar.getWidth() / 2));
+    sidechainToggle.setBounds(dynamicsTopBar);
 
-    parameterSmoothingSlider.setBounds(controlRegion.reduced(0, 20));
+    thresholdSlider.setBounds(dynamicsRegion.removeFromLeft(sliderWidth));
+    ratioSlider.setBounds(dynamicsRegion.removeFromLeft(sliderWidth));
+    attackSlider.setBounds(dynamicsRegion.removeFromLeft(sliderWidth));
+    releaseSlider.setBounds(dynamicsRegion);
 
     responseTrace.setBounds(bounds.reduced(20));
 }
@@ -11,8 +11,8 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "CommonFunctions.h"
-#include "VASVFTraceComponent.h"
-#include "FrequencyDecibelGridOverlay.h"
+#include "TraceAndGrid.h"
+#include "PresetBrowserComponent.h"
 
 //====================Attachments
 class AttachedSlider : public juce::Component
@@ -94,249 +94,89 @@ private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AttachedToggle)
 };
 
-class TraceAndGrid : public juce::Component
+class PresetStrip : public juce::Component
 {
 public:
-    TraceAndGrid(EQParameterReference& ref)
-        : responseTrace(ref)
+    explicit PresetStrip(PresetSlots& slotsToUse)
+        : slots(slotsToUse)
     {
-        setOpaque(true);
-        setBufferedToImage(true);
-        setInterceptsMouseClicks(false, true);
-        setPaintingIsUnclipped(true);
-        setRepaintsOnMouseActivity(false);
-
-        const auto frequencyRange = gedd::createFrequencyRange(20.0, 22000.0);
-        const auto decibelRange = juce::NormalisableRange<double>(-24.0, 24.0);
-
-        dbRangeSlider.setSliderStyle(juce::Slider::SliderStyle::TwoValueVertical);
-        dbRangeSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox, true, 0, 0);
-        dbRangeSlider.setRange(juce::Range<double>(-48.0, 48.0), 1.0);
-        dbRangeSlider.setMinAndMaxValues(-24.0, 24.0, juce::NotificationType::dontSendNotification);
-
-        // lambda
-        dbRangeSlider.onValueChange = [&] { 
-            // Validate
-            const auto min = dbRangeSlider.getMinValue();
-            const auto max = dbRangeSlider.getMaxValue();
-
-            if (min == max) return;
-
-            if (max < min)
-            {
-                dbRangeSlider.setMinValue(max, juce::NotificationType::dontSendNotification);
-                dbRangeSlider.setMaxValue(min, juce::NotificationType::dontSendNotification);
-            }
-
-            // update
-            const auto newRange = juce::NormalisableRange<double>(dbRangeSlider.getMinValue(), dbRangeSlider.getMaxValue());
-            responseTrace.setDecibelNormalisableRange(newRange);
-            grid.setDecibelNormalisableRange(newRange);
-
-            dbLabelBottom.setText(juce::String(static_cast<int>(min)), juce::NotificationType::dontSendNotification);
-            dbLabelTop.setText(juce::String(static_cast<int>(max)), juce::NotificationType::dontSendNotification);
-        };
-
-        freqRangeSlider.setSliderStyle(juce::Slider::SliderStyle::TwoValueHorizontal);
-        freqRangeSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox, true, 0, 0);
-        freqRangeSlider.setNormalisableRange(gedd::createFrequencyRange(1.0, 22050.0, 1.0));
-        freqRangeSlider.setMinAndMaxValues(20.0, 18000.0, juce::NotificationType::dontSendNotification);
-
-        // lambda
-        freqRangeSlider.onValueChange = [&] {
-            // Validate
-            const auto min = freqRangeSlider.getMinValue();
-            const auto max = freqRangeSlider.getMaxValue();
-
-            if (min == max) return;
-
-            if (max < min)
-            {
-                freqRangeSlider.setMinValue(max, juce::NotificationType::dontSendNotification);
-                freqRangeSlider.setMaxValue(min, juce::NotificationType::dontSendNotification);
-            }
-
-            // Update
-            const auto newRange = gedd::createFrequencyRange(freqRangeSlider.getMinValue(), freqRangeSlider.getMaxValue());
-            responseTrace.setFrequencyNormalisableRange(newRange);
-            grid.setFrequencyNormalisableRange(newRange);
-
-            freqLabelLeft.setText(juce::String(static_cast<int>(min)), juce::NotificationType::dontSendNotification);
-            freqLabelRight.setText(juce::String(static_cast<int>(max)), juce::NotificationType::dontSendNotification);
-        };
-
-        showMagnitudeToggle.setToggleState(responseTrace.getShowMagnitudeTrace(), juce::NotificationType::dontSendNotification);
-        showMagnitudeToggle.onStateChange = [&] {
-            responseTrace.setShowMagnitudeTrace(showMagnitudeToggle.getToggleState());
-        };
-
-        showPhaseToggle.setToggleState(responseTrace.getShowPhaseTrace(), juce::NotificationType::dontSendNotification);
-        showPhaseToggle.onStateChange = [&] {
-            responseTrace.setShowPhaseTrace(showPhaseToggle.getToggleState());
-        };
-
-        responseTrace.setFrequencyNormalisableRange(frequencyRange);
-        responseTrace.setDecibelNormalisableRange(decibelRange);
-        grid.setFrequencyNormalisableRange(frequencyRange);
-        grid.setDecibelNormalisableRange(decibelRange);
-
-        // labels
-        dbLabelTop.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
-        dbLabelTop.setJustificationType(juce::Justification::centred);
-        dbLabelTop.setText(juce::String(static_cast<int>(dbRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
-        dbLabelTop.setEditable(true, false, true);
-        dbLabelTop.onTextChange = [&] {
-            auto t = dbLabelTop.getText().trimStart();
-
-            while (t.startsWithChar('+'))
-                t = t.substring(1).trimStart();
-
-            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
-            auto valDbl = valStr.getDoubleValue();
-
-            if (valDbl > dbRangeSlider.getMinValue())
-            {
-                dbRangeSlider.setMaxValue(valDbl, juce::NotificationType::sendNotificationAsync);
-                dbLabelTop.setText(valStr, juce::NotificationType::dontSendNotification);
-            }
-            else
-            {
-                dbLabelTop.setText(juce::String(static_cast<int>(dbRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
-            }
-        };
-        
-        dbLabelBottom.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
-        dbLabelBottom.setJustificationType(juce::Justification::centred);
-        dbLabelBottom.setText(juce::String(static_cast<int>(dbRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
-        dbLabelBottom.setEditable(true, false, true);
-        dbLabelBottom.onTextChange = [&] {
-            auto t = dbLabelBottom.getText().trimStart();
-
-            while (t.startsWithChar('+'))
-                t = t.substring(1).trimStart();
-
-            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
-            auto valDbl = valStr.getDoubleValue();
-
-            if (valDbl < dbRangeSlider.getMaxValue())
-            {
-                dbRangeSlider.setMinValue(valDbl, juce::NotificationType::sendNotificationAsync);
-                dbLabelBottom.setText(valStr, juce::NotificationType::dontSendNotification);
-            }
-            else
-            {
-                dbLabelBottom.setText(juce::String(static_cast<int>(dbRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
-            }
-        };
-
-        freqLabelLeft.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
-        freqLabelLeft.setJustificationType(juce::Justification::centredRight);
-        freqLabelLeft.setText(juce::String(static_cast<int>(freqRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
-        freqLabelLeft.setEditable(true, false, true);
-        freqLabelLeft.onTextChange = [&] {
-            auto t = freqLabelLeft.getText().trimStart();
-
-            while (t.startsWithChar('+'))
-                t = t.substring(1).trimStart();
-
-            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
-            auto valDbl = valStr.getDoubleValue();
-
-            if (valDbl < freqRangeSlider.getMaxValue())
-            {
-                freqRangeSlider.setMinValue(valDbl, juce::NotificationType::sendNotificationAsync);
-                freqLabelLeft.setText(valStr, juce::NotificationType::dontSendNotification);
-            }
-            else
-            {
-                freqLabelLeft.setText(juce::String(static_cast<int>(freqRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
-            }
-        };
-
-        freqLabelRight.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
-        freqLabelRight.setJustificationType(juce::Justification::centredLeft);
-        freqLabelRight.setText(juce::String(static_cast<int>(freqRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
-        freqLabelRight.setEditable(true, false, true);
-        freqLabelRight.onTextChange = [&] {
-            auto t = freqLabelRight.getText().trimStart();
-
-            while (t.startsWithChar('+'))
-                t = t.substring(1).trimStart();
-
-            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
-            auto valDbl = valStr.getDoubleValue();
-
-            if (valDbl > freqRangeSlider.getMinValue())
-            {
-                freqRangeSlider.setMaxValue(valDbl, juce::NotificationType::sendNotificationAsync);
-                freqLabelRight.setText(valStr, juce::NotificationType::dontSendNotification);
-            }
-            else
-            {
-                freqLabelRight.setText(juce::String(static_cast<int>(freqRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
-            }
-        };
-
-        // add to component and make visible
-        addAndMakeVisible(grid);
-        addAndMakeVisible(responseTrace);
-
-        addAndMakeVisible(dbRangeSlider);
-        addAndMakeVisible(freqRangeSlider);
-        addAndMakeVisible(showMagnitudeToggle);
-        addAndMakeVisible(showPhaseToggle);
-
-        addAndMakeVisible(dbLabelTop);
-        addAndMakeVisible(dbLabelBottom);
-        addAndMakeVisible(freqLabelLeft);
-        addAndMakeVisible(freqLabelRight);
-    }
+        for (auto i = 0; i != PresetSlots::numSlots; ++i)
+        {
+            auto& button = slotButtons[static_cast<size_t>(i)];
+
+            button.setButtonText(juce::String(i + 1));
+            button.setClickingTogglesState(false);
+            button.setTooltip("click to recall, with store on to store, shift click to clear");
+            addAndMakeVisible(button);
+
+            // lambda
+            button.onClick = [this, i] {
+                if (juce::ModifierKeys::currentModifiers.isShiftDown())
+                {
+                    slots.clear(i);
+                }
+                else if (storeToggle.getToggleState())
+                {
+                    slots.store(i);
+                    storeToggle.setToggleState(false, juce::NotificationType::dontSendNotification);
+                }
+                else
+                {
+                    slots.recall(i);
+                }
+
+                updateButtons();
+            };
+        }
 
-    void paint(juce::Graphics& g)
-    {
-        g.fillAll(juce::Colours::black);
+        addAndMakeVisible(storeToggle);
+
+        morphTimeSlider.setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
+        morphTimeSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxRight, false, 70, 20);
+        morphTimeSlider.setRange(0.0, 10.0, 0.01);
+        morphTimeSlider.setSkewFactorFromMidPoint(1.0);
+        morphTimeSlider.setTextValueSuffix(" s");
+        morphTimeSlider.setValue(slots.getMorphTime(), juce::NotificationType::dontSendNotification);
+        morphTimeSlider.onValueChange = [&] { slots.setMorphTime(morphTimeSlider.getValue()); };
+        addAndMakeVisible(morphTimeSlider);
+
+        morphTimeLabel.setText("morph", juce::NotificationType::dontSendNotification);
+        morphTimeLabel.attachToComponent(&morphTimeSlider, true);
+
+        updateButtons();
     }
 
     void resized() override
     {
-        const auto elHeight = 30;
-        const auto elWidth = 40;
-
-        auto bounds = getLocalBounds();
-
-        auto toggleRegion = bounds.removeFromTop(elHeight);
+        auto bounds = getLocalBounds().reduced(4);
+        const auto buttonWidth = bounds.getHeight() * 2;
 
-        showMagnitudeToggle.setBounds(toggleRegion.removeFromLeft(toggleRegion.getWidth() / 2));
-        showPhaseToggle.setBounds(toggleRegion);
+        for (auto& button : slotButtons)
+            button.setBounds(bounds.removeFromLeft(buttonWidth).reduced(2));
 
-        // draw freq range
-        auto freqRangeRegion = bounds.removeFromTop(elHeight);
+        storeToggle.setBounds(bounds.removeFromLeft(80).reduced(2));
 
-        freqLabelLeft.setBounds(freqRangeRegion.removeFromLeft(elWidth));
-        freqLabelRight.setBounds(freqRangeRegion.removeFromRight(elWidth));
-        freqRangeSlider.setBounds(freqRangeRegion);
+        // room for the attached label
+        bounds.removeFromLeft(60);
+        morphTimeSlider.setBounds(bounds.removeFromLeft(juce::jmin(bounds.getWidth(), 300)));
+    }
 
-        // draw db range
-        auto dbRangeRegion = bounds.removeFromLeft(elWidth);
+private:
+    // a stored slot is drawn on
+    void updateButtons()
+    {
+        for (auto i = 0; i != PresetSlots::numSlots; ++i)
+            slotButtons[static_cast<size_t>(i)].setToggleState(slots.isStored(i), juce::NotificationType::dontSendNotification);
+    }
 
-        dbLabelTop.setBounds(dbRangeRegion.removeFromTop(elHeight));
-        dbLabelBottom.setBounds(dbRangeRegion.removeFromBottom(elHeight));
-        dbRangeSlider.setBounds(dbRangeRegion);
+    PresetSlots& slots;
 
-        // draw grid and trace
-        grid.setBounds(bounds);
-        responseTrace.setBounds(bounds);
-    }
+    std::array<juce::TextButton, PresetSlots::numSlots> slotButtons;
+    juce::ToggleButton storeToggle{ "store" };
+    juce::Slider morphTimeSlider{ "morphTime" };
+    juce::Label morphTimeLabel;
 
-private:
-    VASVFTraceComponent responseTrace;
-    FrequencyDecibelGridOverlay grid;
-
-    juce::Slider dbRangeSlider{ "dbRange" };
-    juce::Slider freqRangeSlider{ "freqRange" };
-    juce::ToggleButton showMagnitudeToggle{ "mag" };
-    juce::ToggleButton showPhaseToggle{ "phase" };
-    juce::Label dbLabelTop, dbLabelBottom, freqLabelLeft, freqLabelRight;
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetStrip)
 };
 
 //==============================================================================
@@ -360,13 +200,24 @@ private:
     AttachedSlider freqSlider;
     AttachedSlider qSlider;
     AttachedSlider gainSlider;
+    AttachedSlider morphSlider;
     AttachedCombo  filterTypeCombo;
     AttachedToggle autoqToggle;
+    AttachedToggle suppressorToggle;
     TraceAndGrid   responseTrace;
 
-    // ! warning ! - this parameter will interrupt audio processing and so is not to be automated
-    juce::Slider parameterSmoothingSlider{ "smoothing" };
-    juce::Label parameterSmoothingSliderLabel{ "", parameterSmoothingSlider.getName() };
+    // dynamic eq
+    AttachedToggle dynamicToggle;
+    AttachedToggle sidechainToggle;
+    AttachedSlider thresholdSlider;
+    AttachedSlider ratioSlider;
+    AttachedSlider attackSlider;
+    AttachedSlider releaseSlider;
+
+    AttachedSlider smoothingSlider;
+
+    PresetStrip presetStrip;
+    PresetBrowserComponent presetBrowser;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GeddvasvfAudioProcessorEditor)
 };
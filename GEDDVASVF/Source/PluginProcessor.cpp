@@ -11,10 +11,12 @@
 
 //==============================================================================
 GeddvasvfAudioProcessor::GeddvasvfAudioProcessor()
-    : AudioProcessorBase(getDefaultProperties(), createLayout()),
+    : AudioProcessorBase(getDefaultPropertiesWithSidechain(), createLayout()),
     paramRef(apvts),
-    svfProcessorUpdater(paramRef.eqParamRef, svfProcessor)
+    svfProcessorUpdater(paramRef.eqParamRef, svfProcessor),
+    presetSlots(paramRef.eqParamRef)
 {
+    presetSlots.onSlotsChanged = [this] { markStateDirty(); };
 }
 
 GeddvasvfAudioProcessor::~GeddvasvfAudioProcessor()
@@ -25,6 +27,7 @@ GeddvasvfAudioProcessor::~GeddvasvfAudioProcessor()
 void GeddvasvfAudioProcessor::reset()
 {
     svfProcessor.reset();
+    feedbackSuppressor.reset();
 }
 
 //==============================================================================
@@ -32,13 +35,19 @@ void GeddvasvfAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBl
 {
     // Use this method as the place to do any pre-playback
     // initialisation that you need..
-    const auto channels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
+    const auto channels = juce::jmax(getMainBusNumInputChannels(), getMainBusNumOutputChannels());
     if (channels == 0) return;
 
     juce::dsp::ProcessSpec spec{ sampleRate, static_cast<juce::uint32>(samplesPerBlock), static_cast<juce::uint32>(channels) };
 
     // prepare processors here
     svfProcessor.prepare(spec);
+    feedbackSuppressor.prepare(spec);
+    preAnalyser.prepare(spec);
+    postAnalyser.prepare(spec);
+    transferFunctionAnalyser.prepare(spec);
+    subBlockPlan.prepare(samplesPerBlock, maxSubBlockSize, minSubBlockSize);
+    presetSlots.setSampleRate(sampleRate);
 
     reset();
 }
@@ -47,6 +56,7 @@ void GeddvasvfAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
+    feedbackSuppressor.release();
 }
 
 void GeddvasvfAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -54,21 +64,50 @@ void GeddvasvfAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, ju
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
-    const auto numChannels = juce::jmax(totalNumInputChannels, totalNumOutputChannels);
 
-    // update processor state
-    svfProcessorUpdater.updateProcessor();
+    // update processor state, the svf is updated per sub block below
+    feedbackSuppressor.setEnabled(paramRef.eqParamRef.suppressor.get());
 
     // clear extra channels
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    // make context
-    auto inOutBlock = juce::dsp::AudioBlock<float>(buffer).getSubsetChannelBlock(0, numChannels);
+    // make context - main bus only, the sidechain bus follows it in the buffer
+    auto mainBuffer = getBusBuffer(buffer, true, 0);
+    auto sidechainBuffer = getBusBuffer(buffer, true, 1);
+
+    auto inOutBlock = juce::dsp::AudioBlock<float>(mainBuffer);
+    auto sidechainBlock = juce::dsp::AudioBlock<float>(sidechainBuffer);
     auto context = juce::dsp::ProcessContextReplacing<float>(inOutBlock);
 
+    // JUCE's wrappers apply host automation before the block starts, so there are no sample
+    // offset events to add with subBlockPlan.addEvent() yet and the plan holds the regular splits.
+    // Changes made from other threads mid block are still picked up at the next split.
+    subBlockPlan.build(buffer.getNumSamples());
+
     // process
-    svfProcessor.process(context);
+    preAnalyser.pushSamples(inOutBlock);
+
+    transferFunctionAnalyser.captureInput(inOutBlock);
+
+    for (auto i = 0; i != subBlockPlan.getNumSubBlocks(); ++i)
+    {
+        const auto start = static_cast<size_t>(subBlockPlan.getStart(i));
+        const auto num = static_cast<size_t>(subBlockPlan.getLength(i));
+
+        // a recalled preset first, its parameters then match what the processor is morphing to
+        presetSlots.updateProcessor(svfProcessor);
+        svfProcessorUpdater.updateProcessor();
+
+        auto subBlock = inOutBlock.getSubBlock(start, num);
+        svfProcessor.process(juce::dsp::ProcessContextReplacing<float>(subBlock), sidechainBlock.getSubBlock(start, num));
+    }
+
+    transferFunctionAnalyser.captureOutput(inOutBlock);
+
+    feedbackSuppressor.process(context);
+
+    postAnalyser.pushSamples(inOutBlock);
 }
 
 //==============================================================================
@@ -91,24 +130,68 @@ juce::AudioProcessorValueTreeState::ParameterLayout GeddvasvfAudioProcessor::cre
 }
 
 //==============================================================================
-void GeddvasvfAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
+GeddvasvfAudioProcessor::TraceRanges GeddvasvfAudioProcessor::getTraceRanges() const
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
+    const juce::ScopedLock lock(getStateLock());
+    return traceRanges;
+}
 
-    // need to also store state of Trace's ...frequency and decibel ranges...
+void GeddvasvfAudioProcessor::setTraceRanges(const TraceRanges& newRanges)
+{
+    const juce::ScopedLock lock(getStateLock());
 
-    copyXmlToBinary(*apvts.copyState().createXml(), destData);
+    if (newRanges.frequency != traceRanges.frequency || newRanges.decibels != traceRanges.decibels)
+    {
+        traceRanges = newRanges;
+        markStateDirty();
+    }
 }
 
-void GeddvasvfAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
+juce::File GeddvasvfAudioProcessor::getPresetLibraryFile() const
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
-    apvts.replaceState(juce::ValueTree::fromXml(*getXmlFromBinary(data, sizeInBytes)));
+    const juce::ScopedLock lock(getStateLock());
+    return presetLibraryFile;
 }
 
+void GeddvasvfAudioProcessor::setPresetLibraryFile(const juce::File& newFile)
+{
+    const juce::ScopedLock lock(getStateLock());
+
+    if (newFile != presetLibraryFile)
+    {
+        presetLibraryFile = newFile;
+        markStateDirty();
+    }
+}
+
+void GeddvasvfAudioProcessor::writeExtraState(juce::ValueTree& extra)
+{
+    extra.setProperty("traceFrequencyMin", traceRanges.frequency.getStart(), nullptr);
+    extra.setProperty("traceFrequencyMax", traceRanges.frequency.getEnd(), nullptr);
+    extra.setProperty("traceDecibelsMin", traceRanges.decibels.getStart(), nullptr);
+    extra.setProperty("traceDecibelsMax", traceRanges.decibels.getEnd(), nullptr);
+
+    extra.setProperty("presetLibrary", presetLibraryFile.getFullPathName(), nullptr);
+    extra.appendChild(presetSlots.toValueTree(), nullptr);
+}
+
+void GeddvasvfAudioProcessor::readExtraState(const juce::ValueTree& extra)
+{
+    const TraceRanges defaults;
+
+    const auto frequency = juce::Range<double>(static_cast<double>(extra.getProperty("traceFrequencyMin", defaults.frequency.getStart())),
+                                               static_cast<double>(extra.getProperty("traceFrequencyMax", defaults.frequency.getEnd())));
+    const auto decibels = juce::Range<double>(static_cast<double>(extra.getProperty("traceDecibelsMin", defaults.decibels.getStart())),
+                                              static_cast<double>(extra.getProperty("traceDecibelsMax", defaults.decibels.getEnd())));
+
+    traceRanges.frequency = frequency.isEmpty() ? defaults.frequency : frequency;
+    traceRanges.decibels = decibels.isEmpty() ? defaults.decibels : decibels;
+
+    const auto libraryPath = extra.getProperty("presetLibrary").toString();
+    presetLibraryFile = juce::File::isAbsolutePath(libraryPath) ? juce::File(libraryPath) : juce::File();
+
+    presetSlots.fromValueTree(extra.getChildWithName("presets"));
+}
 
 //==============================================================================
 // This creates new instances of the plugin..
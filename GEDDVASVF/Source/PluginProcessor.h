@@ -13,6 +13,11 @@
 #include "ParameterReference.h"
 #include "VASVF.h"
 #include "ProcessorUpdaters.h"
+#include "FeedbackSuppressor.h"
+#include "SpectrumAnalyser.h"
+#include "TransferFunctionAnalyser.h"
+#include "SubBlockPlan.h"
+#include "PresetSlots.h"
 
 //==============================================================================
 /**
@@ -36,18 +41,59 @@ public:
     ParameterReferences& getParameterReferences() noexcept { return paramRef; }
 
     //==============================================================================
-    void getStateInformation(juce::MemoryBlock& destData) override;
-    void setStateInformation(const void* data, int sizeInBytes) override;
+    // the editor's trace view, saved with the plugin state
+    struct TraceRanges
+    {
+        juce::Range<double> frequency{ 20.0, 18000.0 };
+        juce::Range<double> decibels{ -24.0, 24.0 };
+    };
+
+    TraceRanges getTraceRanges() const;
+
+    void setTraceRanges(const TraceRanges& newRanges);
 
     gedd::dsp::VASVFProcessor<float>& getSvfProcessorRef() { return svfProcessor; }
 
+    // stored filter settings, recalled by morphing the coefficients
+    PresetSlots& getPresetSlotsRef() { return presetSlots; }
+
+    // the editor's preset library, saved with the plugin state
+    juce::File getPresetLibraryFile() const;
+
+    void setPresetLibraryFile(const juce::File& newFile);
+
+    // inactive until an editor attaches to them
+    gedd::dsp::SpectrumAnalyser& getPreAnalyserRef() { return preAnalyser; }
+
+    gedd::dsp::SpectrumAnalyser& getPostAnalyserRef() { return postAnalyser; }
+
+    // measures the svf processor alone, inactive until an editor starts measuring
+    gedd::dsp::TransferFunctionAnalyser& getTransferFunctionAnalyserRef() { return transferFunctionAnalyser; }
+
 private:
     ParameterReferences paramRef;
 
     ParameterLayout createLayout() override;
 
+    void writeExtraState(juce::ValueTree& extra) override;
+    void readExtraState(const juce::ValueTree& extra) override;
+
+    TraceRanges traceRanges;
+    juce::File presetLibraryFile;
+
     gedd::dsp::VASVFProcessor<float> svfProcessor;
     VASVFProcessorUpdater<float> svfProcessorUpdater;
+    PresetSlots presetSlots;
+
+    // parameters and ramps are updated per sub block, not per host buffer
+    static constexpr int maxSubBlockSize{ 64 };
+    static constexpr int minSubBlockSize{ 16 };
+    gedd::SubBlockPlan subBlockPlan;
+
+    gedd::dsp::FeedbackSuppressor<float> feedbackSuppressor;
+
+    gedd::dsp::SpectrumAnalyser preAnalyser, postAnalyser;
+    gedd::dsp::TransferFunctionAnalyser transferFunctionAnalyser;
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GeddvasvfAudioProcessor)
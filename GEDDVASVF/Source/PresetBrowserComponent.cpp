@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    PresetBrowserComponent.cpp
+    Created: 20 Oct 2026 12:58:06am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "PresetBrowserComponent.h"
+
+//==============================================================================
+PresetBrowserComponent::PresetBrowserComponent(PresetSlots& slotsToUse)
+    : slots(slotsToUse)
+{
+    setColour(thumbnailColourID, juce::Colours::white);
+    setColour(nameColourID, juce::Colours::lightgrey);
+    setColour(selectedColourID, juce::Colours::white.withAlpha(0.15f));
+
+    openButton.onClick = [&] { chooseLibrary(); };
+    addAndMakeVisible(openButton);
+
+    libraryLabel.setJustificationType(juce::Justification::centredLeft);
+    libraryLabel.setText("no library", juce::NotificationType::dontSendNotification);
+    addAndMakeVisible(libraryLabel);
+
+    listBox.setModel(this);
+    listBox.setRowHeight(rowHeight);
+    addAndMakeVisible(listBox);
+
+    thumbnails.onThumbnailReady = [&](int row) { listBox.repaintRow(row); };
+
+    updateThumbnailStyle();
+}
+
+PresetBrowserComponent::~PresetBrowserComponent()
+{
+    listBox.setModel(nullptr);
+}
+
+void PresetBrowserComponent::paint(juce::Graphics& g)
+{
+    g.fillAll(getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId).darker(0.2f));
+}
+
+void PresetBrowserComponent::resized()
+{
+    auto bounds = getLocalBounds().reduced(4);
+    auto topBar = bounds.removeFromTop(24);
+
+    openButton.setBounds(topBar.removeFromLeft(110));
+    libraryLabel.setBounds(topBar);
+
+    bounds.removeFromTop(4);
+    listBox.setBounds(bounds);
+}
+
+void PresetBrowserComponent::colourChanged()
+{
+    updateThumbnailStyle();
+    listBox.repaint();
+}
+
+bool PresetBrowserComponent::openLibrary(const juce::File& file)
+{
+    const auto opened = library.open(file);
+
+    libraryLabel.setText(opened ? file.getFileNameWithoutExtension() : "no library", juce::NotificationType::dontSendNotification);
+
+    // thumbnails are keyed by row
+    thumbnails.clear();
+
+    listBox.updateContent();
+    listBox.scrollToEnsureRowIsOnscreen(0);
+    listBox.repaint();
+
+    return opened;
+}
+
+int PresetBrowserComponent::getNumRows()
+{
+    return library.getNumPresets();
+}
+
+void PresetBrowserComponent::paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected)
+{
+    if (!juce::isPositiveAndBelow(rowNumber, library.getNumPresets()))
+        return;
+
+    if (rowIsSelected)
+        g.fillAll(findColour(selectedColourID));
+
+    auto bounds = juce::Rectangle<int>(0, 0, width, height).reduced(2);
+    const auto thumbnailBounds = bounds.removeFromLeft(thumbnailWidth);
+
+    // not rendered yet, leave the space empty until onThumbnailReady repaints the row.
+    // Drawn from the same legal values a recall would use
+    const auto thumbnail = thumbnails.getThumbnail(rowNumber, slots.makeLegal(library.getPreset(rowNumber)));
+
+    if (thumbnail.isValid())
+        g.drawImageAt(thumbnail, thumbnailBounds.getX(), thumbnailBounds.getY());
+
+    bounds.removeFromLeft(6);
+
+    g.setColour(findColour(nameColourID));
+    g.drawFittedText(library.getName(rowNumber), bounds, juce::Justification::centredLeft, 1);
+}
+
+void PresetBrowserComponent::listBoxItemDoubleClicked(int row, const juce::MouseEvent&)
+{
+    recallRow(row);
+}
+
+void PresetBrowserComponent::returnKeyPressed(int lastRowSelected)
+{
+    recallRow(lastRowSelected);
+}
+
+void PresetBrowserComponent::recallRow(int row)
+{
+    if (juce::isPositiveAndBelow(row, library.getNumPresets()))
+        slots.recall(library.getPreset(row));
+}
+
+void PresetBrowserComponent::chooseLibrary()
+{
+    chooser = std::make_unique<juce::FileChooser>("Open a preset library", library.getFile(), "*.gedl");
+
+    const auto flags = juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles;
+
+    // lambda
+    chooser->launchAsync(flags, [this](const juce::FileChooser& fc)
+    {
+        const auto file = fc.getResult();
+
+        if (file == juce::File() || !openLibrary(file))
+            return;
+
+        if (onLibraryChanged != nullptr)
+            onLibraryChanged(file);
+    });
+}
+
+void PresetBrowserComponent::updateThumbnailStyle()
+{
+    thumbnails.setStyle(thumbnailWidth, rowHeight - 4, findColour(thumbnailColourID),
+                        gedd::createFrequencyRange(20.0, 20000.0), juce::NormalisableRange<double>(-24.0, 24.0));
+}
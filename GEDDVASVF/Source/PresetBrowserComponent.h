@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    PresetBrowserComponent.h
+    Created: 20 Oct 2026 12:58:06am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PresetLibrary.h"
+#include "PresetThumbnailCache.h"
+#include "PresetSlots.h"
+#include "CommonFunctions.h"
+
+//==============================================================================
+/*
+* Lists the presets of a library with a thumbnail of each response. Double click
+* or return morphs to the preset like recalling a slot.
+*
+* Rows only ask the cache for their thumbnail while painting, so only what is on
+* screen is ever rendered and scrolling never waits for it.
+*/
+class PresetBrowserComponent : public juce::Component,
+                               private juce::ListBoxModel
+{
+public:
+    enum ColourIDs
+    {
+        thumbnailColourID   = 0x8800400,
+        nameColourID        = 0x8800401,
+        selectedColourID    = 0x8800402
+    };
+
+    explicit PresetBrowserComponent(PresetSlots& slotsToUse);
+
+    ~PresetBrowserComponent() override;
+
+    void paint(juce::Graphics& g) override;
+
+    void resized() override;
+
+    void colourChanged() override;
+
+    // message thread, false if the file isn't a library
+    bool openLibrary(const juce::File& file);
+
+    const juce::File& getLibraryFile() const noexcept { return library.getFile(); }
+
+    // called when the user opens a different library
+    std::function<void(const juce::File&)> onLibraryChanged;
+
+private:
+    // ListBoxModel
+    int getNumRows() override;
+
+    void paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
+
+    void listBoxItemDoubleClicked(int row, const juce::MouseEvent&) override;
+
+    void returnKeyPressed(int lastRowSelected) override;
+
+    void recallRow(int row);
+
+    void chooseLibrary();
+
+    void updateThumbnailStyle();
+
+    //============================================================
+    static constexpr int rowHeight{ 40 };
+    static constexpr int thumbnailWidth{ 80 };
+
+    PresetSlots& slots;
+
+    PresetLibrary library;
+    PresetThumbnailCache thumbnails;
+
+    juce::TextButton openButton{ "open library..." };
+    juce::Label libraryLabel;
+    juce::ListBox listBox;
+
+    std::unique_ptr<juce::FileChooser> chooser;
+
+    //============================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBrowserComponent)
+};
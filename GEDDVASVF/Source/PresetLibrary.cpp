@@ -0,0 +1,160 @@
+/*
+  ==============================================================================
+
+    PresetLibrary.cpp
+    Created: 20 Oct 2026 12:05:18am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "PresetLibrary.h"
+
+namespace
+{
+    juce::uint32 readUint(const char* p) noexcept
+    {
+        return juce::ByteOrder::littleEndianInt(p);
+    }
+
+    float readFloat(const char* p) noexcept
+    {
+        const auto bits = readUint(p);
+
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    bool writeUint(juce::OutputStream& out, juce::uint32 value)
+    {
+        return out.writeInt(static_cast<int>(value));
+    }
+}
+
+bool PresetLibrary::open(const juce::File& file)
+{
+    close();
+
+    auto newMapped = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+    const auto* newData = static_cast<const char*>(newMapped->getData());
+    const auto newSize = newMapped->getSize();
+
+    if (newData == nullptr || newSize < headerSize)
+        return false;
+
+    if (readUint(newData) != magic || readUint(newData + 4) != version || readUint(newData + 12) != recordSize)
+        return false;
+
+    const auto count = static_cast<size_t>(readUint(newData + 8));
+
+    // the whole index has to be in the file, names are checked as they are read
+    if (count > static_cast<size_t>(std::numeric_limits<int>::max()) || count > (newSize - headerSize) / recordSize)
+        return false;
+
+    mapped = std::move(newMapped);
+    libraryFile = file;
+    data = newData;
+    dataSize = newSize;
+    numPresets = static_cast<int>(count);
+
+    return true;
+}
+
+void PresetLibrary::close()
+{
+    mapped.reset();
+    libraryFile = juce::File();
+    data = nullptr;
+    dataSize = 0;
+    numPresets = 0;
+}
+
+PresetLibrary::Preset PresetLibrary::getPreset(int index) const noexcept
+{
+    Preset preset;
+
+    if (const auto* record = getRecord(index))
+    {
+        preset.type = static_cast<int>(readUint(record + 8));
+        preset.frequency = readFloat(record + 12);
+        preset.gain = readFloat(record + 16);
+        preset.q = readFloat(record + 20);
+        preset.morph = readFloat(record + 24);
+        preset.autoQ = (readUint(record + 28) & 1) != 0;
+    }
+
+    return preset;
+}
+
+juce::String PresetLibrary::getName(int index) const
+{
+    const auto* record = getRecord(index);
+
+    if (record == nullptr)
+        return {};
+
+    const auto offset = static_cast<size_t>(readUint(record));
+    const auto length = static_cast<size_t>(readUint(record + 4));
+
+    if (offset > dataSize || length > dataSize - offset)
+        return {};
+
+    return juce::String::fromUTF8(data + offset, static_cast<int>(length));
+}
+
+bool PresetLibrary::write(const juce::File& file, const std::vector<std::pair<juce::String, Preset>>& presets)
+{
+    juce::TemporaryFile temp(file);
+
+    {
+        juce::FileOutputStream out(temp.getFile());
+
+        if (out.failedToOpen())
+            return false;
+
+        const auto count = static_cast<juce::uint32>(presets.size());
+        auto ok = writeUint(out, magic) && writeUint(out, version) && writeUint(out, count) && writeUint(out, recordSize);
+
+        auto nameOffset = static_cast<juce::uint64>(headerSize + recordSize * presets.size());
+
+        for (const auto& p : presets)
+        {
+            const auto nameLength = static_cast<juce::uint32>(p.first.getNumBytesAsUTF8());
+            const auto& preset = p.second;
+
+            // offsets are 32 bit
+            if (nameOffset + nameLength > std::numeric_limits<juce::uint32>::max())
+                return false;
+
+            ok = ok && writeUint(out, static_cast<juce::uint32>(nameOffset))
+                    && writeUint(out, nameLength)
+                    && out.writeInt(preset.type)
+                    && out.writeFloat(preset.frequency)
+                    && out.writeFloat(preset.gain)
+                    && out.writeFloat(preset.q)
+                    && out.writeFloat(preset.morph)
+                    && writeUint(out, preset.autoQ ? 1u : 0u);
+
+            nameOffset += nameLength;
+        }
+
+        for (const auto& p : presets)
+            ok = ok && out.write(p.first.toRawUTF8(), p.first.getNumBytesAsUTF8());
+
+        out.flush();
+
+        if (!ok || out.getStatus().failed())
+            return false;
+    }
+
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+const char* PresetLibrary::getRecord(int index) const noexcept
+{
+    if (!juce::isPositiveAndBelow(index, numPresets))
+        return nullptr;
+
+    return data + headerSize + recordSize * static_cast<size_t>(index);
+}
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    PresetLibrary.h
+    Created: 20 Oct 2026 12:05:18am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/*
+    A read only library of filter presets in one memory mapped file.
+
+    The file starts with a fixed index of equal sized records, followed by the
+    names. Opening only maps the file and checks the header, and any preset is
+    read straight out of its record, so neither depends on the size of the library.
+
+    Layout, little endian:
+        header    magic, version, number of presets, record size     (4 x uint32)
+        records   name offset, name length (uint32), type (int32),
+                  frequency, gain, q, morph (float32), flags (uint32)
+        names     utf8, not terminated
+*/
+class PresetLibrary
+{
+public:
+    struct Preset
+    {
+        int type{ 0 };
+        float frequency{ 1000.0f }, gain{ 0.0f }, q{ 0.707f }, morph{ 0.0f };
+        bool autoQ{ false };
+    };
+
+    PresetLibrary() = default;
+
+    // message thread, false if the file can't be mapped or isn't a library
+    bool open(const juce::File& file);
+
+    void close();
+
+    bool isOpen() const noexcept { return mapped != nullptr; }
+
+    const juce::File& getFile() const noexcept { return libraryFile; }
+
+    int getNumPresets() const noexcept { return numPresets; }
+
+    // message thread, decodes one record
+    Preset getPreset(int index) const noexcept;
+
+    juce::String getName(int index) const;
+
+    // writes a library, replacing the file
+    static bool write(const juce::File& file, const std::vector<std::pair<juce::String, Preset>>& presets);
+
+private:
+    static constexpr juce::uint32 magic{ 0x4c444547 };      // "GEDL"
+    static constexpr juce::uint32 version{ 1 };
+    static constexpr size_t headerSize{ 16 };
+    static constexpr size_t recordSize{ 32 };
+
+    const char* getRecord(int index) const noexcept;
+
+    std::unique_ptr<juce::MemoryMappedFile> mapped;
+    juce::File libraryFile;
+
+    const char* data{ nullptr };
+    size_t dataSize{ 0 };
+    int numPresets{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetLibrary)
+};
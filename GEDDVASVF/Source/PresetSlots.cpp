@@ -0,0 +1,251 @@
+/*
+  ==============================================================================
+
+    PresetSlots.cpp
+    Created: 19 Oct 2026 11:12:40pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "PresetSlots.h"
+
+PresetSlots::PresetSlots(EQParameterReference& ref)
+    : paramRef(ref)
+{
+}
+
+void PresetSlots::setSampleRate(double newSampleRate)
+{
+    jassert(newSampleRate > 0);
+
+    const juce::ScopedLock sl(lock);
+
+    if (newSampleRate == sampleRate)
+        return;
+
+    sampleRate = newSampleRate;
+
+    for (auto& slot : slots)
+        if (slot.stored)
+            design(slot);
+}
+
+void PresetSlots::store(int slot)
+{
+    jassert(juce::isPositiveAndBelow(slot, numSlots));
+
+    {
+        const juce::ScopedLock sl(lock);
+        auto& s = slots[static_cast<size_t>(slot)];
+
+        s.type = paramRef.type.getIndex();
+        s.frequency = paramRef.freq.get();
+        s.gain = paramRef.gain.get();
+        s.q = paramRef.q.get();
+        s.morph = paramRef.morph.get();
+        s.autoQ = paramRef.autoq.get();
+        s.stored = true;
+
+        design(s);
+    }
+
+    if (onSlotsChanged != nullptr)
+        onSlotsChanged();
+}
+
+void PresetSlots::clear(int slot)
+{
+    jassert(juce::isPositiveAndBelow(slot, numSlots));
+
+    {
+        const juce::ScopedLock sl(lock);
+        slots[static_cast<size_t>(slot)].stored = false;
+    }
+
+    if (onSlotsChanged != nullptr)
+        onSlotsChanged();
+}
+
+void PresetSlots::recall(int slot)
+{
+    jassert(juce::isPositiveAndBelow(slot, numSlots));
+
+    Slot s;
+
+    {
+        const juce::ScopedLock sl(lock);
+        s = slots[static_cast<size_t>(slot)];
+    }
+
+    startRecall(s);
+}
+
+void PresetSlots::recall(const PresetLibrary::Preset& preset)
+{
+    // a shared library may hold anything
+    const auto legal = makeLegal(preset);
+
+    Slot s;
+    s.type = legal.type;
+    s.frequency = legal.frequency;
+    s.gain = legal.gain;
+    s.q = legal.q;
+    s.morph = legal.morph;
+    s.autoQ = legal.autoQ;
+    s.stored = true;
+
+    {
+        const juce::ScopedLock sl(lock);
+        design(s);
+    }
+
+    startRecall(s);
+}
+
+PresetLibrary::Preset PresetSlots::makeLegal(const PresetLibrary::Preset& preset) const
+{
+    // snapToLegalValue() passes NaN through
+    auto legal = [](const juce::RangedAudioParameter& p, float value)
+    {
+        if (!std::isfinite(value))
+            return p.convertFrom0to1(p.getDefaultValue());
+
+        return p.getNormalisableRange().snapToLegalValue(value);
+    };
+
+    PresetLibrary::Preset legalPreset;
+    legalPreset.type = juce::jlimit(0, paramRef.type.choices.size() - 1, preset.type);
+    legalPreset.frequency = legal(paramRef.freq, preset.frequency);
+    legalPreset.gain = legal(paramRef.gain, preset.gain);
+    legalPreset.q = legal(paramRef.q, preset.q);
+    legalPreset.morph = legal(paramRef.morph, preset.morph);
+    legalPreset.autoQ = preset.autoQ;
+
+    return legalPreset;
+}
+
+bool PresetSlots::isStored(int slot) const
+{
+    jassert(juce::isPositiveAndBelow(slot, numSlots));
+
+    const juce::ScopedLock sl(lock);
+    return slots[static_cast<size_t>(slot)].stored;
+}
+
+void PresetSlots::setMorphTime(double seconds)
+{
+    jassert(seconds >= 0.0);
+
+    if (morphTime.exchange(seconds) != seconds && onSlotsChanged != nullptr)
+        onSlotsChanged();
+}
+
+juce::ValueTree PresetSlots::toValueTree() const
+{
+    const juce::ScopedLock sl(lock);
+
+    juce::ValueTree tree("presets");
+    tree.setProperty("morphTime", morphTime.load(), nullptr);
+
+    for (auto i = 0; i != numSlots; ++i)
+    {
+        const auto& s = slots[static_cast<size_t>(i)];
+
+        if (!s.stored)
+            continue;
+
+        juce::ValueTree child("slot");
+        child.setProperty("index", i, nullptr);
+        child.setProperty("type", s.type, nullptr);
+        child.setProperty("frequency", s.frequency, nullptr);
+        child.setProperty("gain", s.gain, nullptr);
+        child.setProperty("q", s.q, nullptr);
+        child.setProperty("morph", s.morph, nullptr);
+        child.setProperty("autoQ", s.autoQ, nullptr);
+
+        tree.appendChild(child, nullptr);
+    }
+
+    return tree;
+}
+
+void PresetSlots::fromValueTree(const juce::ValueTree& tree)
+{
+    const juce::ScopedLock sl(lock);
+
+    for (auto& s : slots)
+        s.stored = false;
+
+    if (!tree.isValid())
+        return;
+
+    morphTime = static_cast<double>(tree.getProperty("morphTime", 2.0));
+
+    for (const auto& child : tree)
+    {
+        const auto index = static_cast<int>(child.getProperty("index", -1));
+
+        if (!juce::isPositiveAndBelow(index, numSlots))
+            continue;
+
+        auto& s = slots[static_cast<size_t>(index)];
+
+        s.type = child.getProperty("type", 0);
+        s.frequency = child.getProperty("frequency", 1000.0f);
+        s.gain = child.getProperty("gain", 0.0f);
+        s.q = child.getProperty("q", 0.707f);
+        s.morph = child.getProperty("morph", 0.0f);
+        s.autoQ = child.getProperty("autoQ", false);
+        s.stored = true;
+
+        design(s);
+    }
+}
+
+void PresetSlots::startRecall(const Slot& slot)
+{
+    // not stored, or stored before the first prepareToPlay()
+    if (!slot.stored || slot.state.sampleRate == 0.0)
+        return;
+
+    Recall r;
+    r.slot = slot;
+    r.seconds = morphTime.load();
+
+    // the design first, so the parameter changes below find the processor already there
+    pending.store(r);
+
+    auto set = [](juce::RangedAudioParameter& p, float value)
+    {
+        p.beginChangeGesture();
+        p.setValueNotifyingHost(p.convertTo0to1(value));
+        p.endChangeGesture();
+    };
+
+    set(paramRef.type, static_cast<float>(slot.type));
+    set(paramRef.freq, slot.frequency);
+    set(paramRef.gain, slot.gain);
+    set(paramRef.q, slot.q);
+    set(paramRef.morph, slot.morph);
+    set(paramRef.autoq, slot.autoQ ? 1.0f : 0.0f);
+}
+
+void PresetSlots::design(Slot& slot) const
+{
+    // designed later by setSampleRate()
+    if (sampleRate <= 0.0)
+    {
+        slot.state.sampleRate = 0.0;
+        return;
+    }
+
+    const auto type = static_cast<gedd::dsp::VASVF::FilterType>(slot.type);
+
+    const gedd::dsp::VASVF::State<double> designed(type == gedd::dsp::VASVF::FilterType::none
+        ? gedd::dsp::VASVF::ArrayState<double>::makeNone()
+        : gedd::dsp::VASVF::ArrayState<double>::make(type, sampleRate, slot.frequency, slot.gain, slot.q, slot.autoQ, slot.morph));
+
+    slot.state.data = designed.data;
+    slot.state.sampleRate = sampleRate;
+}
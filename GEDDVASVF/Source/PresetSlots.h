@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    PresetSlots.h
+    Created: 19 Oct 2026 11:12:40pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "ParameterReference.h"
+#include "VASVFProcessor.h"
+#include "SeqLock.h"
+#include "PresetLibrary.h"
+
+/*
+    Snapshots of the filter parameters, with their coefficients designed when the
+    slot is stored (and again if the sample rate changes).
+
+    Recalling a slot hands the stored design to the audio thread, which morphs to it in
+    coefficient space, then moves the parameters so the host and editor follow. The
+    processor already holds those values by then, so no ramp or redesign is triggered.
+*/
+class PresetSlots
+{
+public:
+    static constexpr int numSlots{ 4 };
+
+    explicit PresetSlots(EQParameterReference& ref);
+
+    // not the audio thread
+    void setSampleRate(double newSampleRate);
+
+    // message thread
+    void store(int slot);
+
+    void clear(int slot);
+
+    void recall(int slot);
+
+    // morphs to a preset from a library, without storing it
+    void recall(const PresetLibrary::Preset& preset);
+
+    // a library preset kept to what the parameters can take, non finite values become the defaults
+    PresetLibrary::Preset makeLegal(const PresetLibrary::Preset& preset) const;
+
+    bool isStored(int slot) const;
+
+    void setMorphTime(double seconds);
+
+    double getMorphTime() const { return morphTime.load(); }
+
+    // called on the message thread when a slot or the morph time changes
+    std::function<void()> onSlotsChanged;
+
+    // audio thread, starts a morph recalled since the last call
+    template<typename SampleType>
+    void updateProcessor(gedd::dsp::VASVFProcessor<SampleType>& processor) noexcept
+    {
+        const auto sequence = pending.getSequence();
+
+        if (sequence == lastSequence)
+            return;
+
+        Recall r;
+
+        if (!pending.load(r))
+            return;
+
+        lastSequence = sequence;
+
+        typename gedd::dsp::VASVFProcessor<SampleType>::MorphTarget target;
+        target.type = static_cast<gedd::dsp::VASVF::FilterType>(r.slot.type);
+        target.frequency = static_cast<SampleType>(r.slot.frequency);
+        target.gain = static_cast<SampleType>(r.slot.gain);
+        target.q = static_cast<SampleType>(r.slot.q);
+        target.morph = static_cast<SampleType>(r.slot.morph);
+        target.autoQ = r.slot.autoQ;
+        target.state = r.slot.state;
+
+        processor.morphTo(target, r.seconds);
+    }
+
+    // saved with the plugin state, message thread
+    juce::ValueTree toValueTree() const;
+
+    void fromValueTree(const juce::ValueTree& tree);
+
+private:
+    struct Slot
+    {
+        bool stored{ false };
+        int type{ 0 };
+        float frequency{ 1000.0f }, gain{ 0.0f }, q{ 0.707f }, morph{ 0.0f };
+        bool autoQ{ false };
+
+        gedd::dsp::VASVF::StateSnapshot state;
+    };
+
+    struct Recall
+    {
+        Slot slot;
+        double seconds{ 0.0 };
+    };
+
+    void design(Slot& slot) const;
+
+    void startRecall(const Slot& slot);
+
+    EQParameterReference& paramRef;
+
+    juce::CriticalSection lock;
+    std::array<Slot, numSlots> slots;
+    double sampleRate{ 0.0 };
+
+    std::atomic<double> morphTime{ 2.0 };
+
+    // message thread -> audio thread
+    gedd::SeqLock<Recall> pending;
+    uint32_t lastSequence{ 0 };     // audio thread only
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetSlots)
+};
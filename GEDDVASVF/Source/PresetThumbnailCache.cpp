@@ -0,0 +1,225 @@
+/*
+  ==============================================================================
+
+    PresetThumbnailCache.cpp
+    Created: 20 Oct 2026 12:31:52am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "PresetThumbnailCache.h"
+
+//==============================================================================
+class PresetThumbnailCache::RenderJob : public juce::ThreadPoolJob
+{
+public:
+    RenderJob(PresetThumbnailCache& ownerToUse, std::shared_ptr<const Style> styleToUse,
+              int keyToUse, int generationToUse, const PresetLibrary::Preset& presetToUse)
+        : juce::ThreadPoolJob("thumbnail"),
+        owner(ownerToUse),
+        style(std::move(styleToUse)),
+        key(keyToUse),
+        generation(generationToUse),
+        preset(presetToUse)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        if (shouldExit())
+            return jobHasFinished;
+
+        Rendered r;
+        r.key = key;
+        r.generation = generation;
+        r.image = render(*style, preset);
+
+        owner.finished(std::move(r));
+        return jobHasFinished;
+    }
+
+private:
+    PresetThumbnailCache& owner;
+    std::shared_ptr<const Style> style;
+    const int key, generation;
+    const PresetLibrary::Preset preset;
+};
+
+//==============================================================================
+PresetThumbnailCache::PresetThumbnailCache(int numThreads, int maxThumbnailsToKeep)
+    : pool(numThreads),
+    maxThumbnails(static_cast<size_t>(juce::jmax(1, maxThumbnailsToKeep)))
+{
+}
+
+PresetThumbnailCache::~PresetThumbnailCache()
+{
+    // jobs hold a reference to this
+    pool.removeAllJobs(true, -1);
+    cancelPendingUpdate();
+}
+
+void PresetThumbnailCache::setStyle(int width, int height, juce::Colour colour,
+                                    const juce::NormalisableRange<double>& frequencyRange,
+                                    const juce::NormalisableRange<double>& decibelRange)
+{
+    jassert(width > 0 && height > 0);
+
+    if (style != nullptr && style->width == width && style->height == height && style->colour == colour
+        && sameRange(style->frequencyRange, frequencyRange) && sameRange(style->decibelRange, decibelRange))
+        return;
+
+    auto newStyle = std::make_shared<Style>();
+    newStyle->width = width;
+    newStyle->height = height;
+    newStyle->colour = colour;
+    newStyle->frequencyRange = frequencyRange;
+    newStyle->decibelRange = decibelRange;
+
+    // one point per pixel column, below nyquist at the design rate
+    std::vector<double> frequencies(static_cast<size_t>(width));
+
+    for (auto x = 0; x != width; ++x)
+    {
+        const auto proportion = width > 1 ? static_cast<double>(x) / static_cast<double>(width - 1) : 0.0;
+        frequencies[static_cast<size_t>(x)] = juce::jmin(frequencyRange.convertFrom0to1(proportion), designSampleRate * 0.499);
+    }
+
+    newStyle->table.setFrequencies(frequencies.data(), frequencies.size(), designSampleRate);
+
+    style = std::move(newStyle);
+    clear();
+}
+
+juce::Image PresetThumbnailCache::getThumbnail(int key, const PresetLibrary::Preset& preset)
+{
+    if (style == nullptr)
+        return {};
+
+    const auto it = cache.find(key);
+
+    if (it != cache.end())
+    {
+        it->second.lastUsed = ++useCounter;
+        return it->second.image;
+    }
+
+    if (queued.insert(key).second)
+        pool.addJob(new RenderJob(*this, style, key, generation, preset), true);
+
+    return {};
+}
+
+void PresetThumbnailCache::clear()
+{
+    // queued jobs would only be thrown away, one already rendering is dropped by its generation
+    pool.removeAllJobs(false, 0);
+
+    ++generation;
+    cache.clear();
+    queued.clear();
+}
+
+bool PresetThumbnailCache::sameRange(const juce::NormalisableRange<double>& a, const juce::NormalisableRange<double>& b) noexcept
+{
+    return a.start == b.start && a.end == b.end && a.skew == b.skew && a.symmetricSkew == b.symmetricSkew;
+}
+
+juce::Image PresetThumbnailCache::render(const Style& style, const PresetLibrary::Preset& preset)
+{
+    using namespace gedd::dsp::VASVF;
+
+    const auto type = static_cast<FilterType>(preset.type);
+    const auto frequency = juce::jlimit(1.0, designSampleRate * 0.499, static_cast<double>(preset.frequency));
+
+    const State<double> state(type == FilterType::none
+        ? ArrayState<double>::makeNone()
+        : ArrayState<double>::make(type, designSampleRate, frequency, preset.gain, juce::jmax(0.025, static_cast<double>(preset.q)),
+                                   preset.autoQ, preset.morph));
+
+    const auto numPoints = style.table.getNumFrequencies();
+    std::vector<double> magnitudes(numPoints);
+    state.getResponseForFrequencyArray(style.table, magnitudes.data(), nullptr);
+
+    // software image, drawn off the message thread
+    juce::Image image(juce::Image::ARGB, style.width, style.height, true, juce::SoftwareImageType());
+
+    const auto& range = style.decibelRange;
+    const auto height = static_cast<float>(style.height);
+
+    juce::Path path;
+
+    for (size_t x = 0; x != numPoints; ++x)
+    {
+        const auto db = range.snapToLegalValue(juce::Decibels::gainToDecibels(magnitudes[x]));
+        const auto y = height * (1.0f - static_cast<float>(range.convertTo0to1(db)));
+
+        if (x == 0)
+            path.startNewSubPath(0.0f, y);
+        else
+            path.lineTo(static_cast<float>(x), y);
+    }
+
+    juce::Graphics g(image);
+
+    // unity gain for reference
+    const auto zero = height * (1.0f - static_cast<float>(range.convertTo0to1(range.snapToLegalValue(0.0))));
+    g.setColour(style.colour.withMultipliedAlpha(0.3f));
+    g.drawHorizontalLine(juce::roundToInt(zero), 0.0f, static_cast<float>(style.width));
+
+    g.setColour(style.colour);
+    g.strokePath(path, juce::PathStrokeType(1.0f));
+
+    return image;
+}
+
+void PresetThumbnailCache::finished(Rendered&& r)
+{
+    {
+        const juce::ScopedLock sl(renderedLock);
+        rendered.push_back(std::move(r));
+    }
+
+    triggerAsyncUpdate();
+}
+
+void PresetThumbnailCache::handleAsyncUpdate()
+{
+    std::vector<Rendered> ready;
+
+    {
+        const juce::ScopedLock sl(renderedLock);
+        ready.swap(rendered);
+    }
+
+    for (auto& r : ready)
+    {
+        // rendered for a style or library since replaced
+        if (r.generation != generation)
+            continue;
+
+        queued.erase(r.key);
+        cache[r.key] = { std::move(r.image), ++useCounter };
+    }
+
+    evict();
+
+    if (onThumbnailReady != nullptr)
+        for (const auto& r : ready)
+            if (r.generation == generation)
+                onThumbnailReady(r.key);
+}
+
+void PresetThumbnailCache::evict()
+{
+    while (cache.size() > maxThumbnails)
+    {
+        const auto oldest = std::min_element(cache.begin(), cache.end(), [](const auto& a, const auto& b)
+        {
+            return a.second.lastUsed < b.second.lastUsed;
+        });
+
+        cache.erase(oldest);
+    }
+}
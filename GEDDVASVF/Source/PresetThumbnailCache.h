@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    PresetThumbnailCache.h
+    Created: 20 Oct 2026 12:31:52am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "PresetLibrary.h"
+#include "VASVF.h"
+
+/*
+    Magnitude response thumbnails of presets, drawn on a pool of background threads
+    and kept in a least recently used cache.
+
+    getThumbnail() never waits, it returns what is cached and queues anything missing.
+    The response is evaluated against one shared ResponseTable, so a thumbnail only
+    costs the SIMD quadratics and the path.
+*/
+class PresetThumbnailCache : private juce::AsyncUpdater
+{
+public:
+    explicit PresetThumbnailCache(int numThreads = 2, int maxThumbnailsToKeep = 256);
+
+    ~PresetThumbnailCache() override;
+
+    // message thread, drops every thumbnail if anything changes
+    void setStyle(int width, int height, juce::Colour colour,
+                  const juce::NormalisableRange<double>& frequencyRange,
+                  const juce::NormalisableRange<double>& decibelRange);
+
+    /*
+        Message thread. A null image if the thumbnail isn't ready yet, onThumbnailReady
+        is called with the key once it is. Keys are the caller's, e.g. a library index.
+        The preset's values have to be legal already, see PresetSlots::makeLegal().
+    */
+    juce::Image getThumbnail(int key, const PresetLibrary::Preset& preset);
+
+    // message thread, e.g. when a different library is opened
+    void clear();
+
+    int getNumCached() const noexcept { return static_cast<int>(cache.size()); }
+
+    std::function<void(int key)> onThumbnailReady;
+
+    // sample rate the presets are designed at
+    static constexpr double designSampleRate{ 48000.0 };
+
+private:
+    struct Style
+    {
+        int width{ 0 }, height{ 0 };
+        juce::Colour colour;
+        juce::NormalisableRange<double> frequencyRange, decibelRange;
+
+        // built once per style, read only while jobs share it
+        gedd::dsp::VASVF::ResponseTable table;
+    };
+
+    class RenderJob;
+
+    struct CachedThumbnail
+    {
+        juce::Image image;
+        juce::uint64 lastUsed{ 0 };
+    };
+
+    struct Rendered
+    {
+        int key{ 0 };
+        int generation{ 0 };
+        juce::Image image;
+    };
+
+    static bool sameRange(const juce::NormalisableRange<double>& a, const juce::NormalisableRange<double>& b) noexcept;
+
+    // render thread
+    static juce::Image render(const Style& style, const PresetLibrary::Preset& preset);
+
+    void finished(Rendered&& rendered);
+
+    // message thread
+    void handleAsyncUpdate() override;
+
+    void evict();
+
+    juce::ThreadPool pool;
+    const size_t maxThumbnails;
+
+    std::shared_ptr<const Style> style;
+    int generation{ 0 };
+
+    std::map<int, CachedThumbnail> cache;
+    std::set<int> queued;
+    juce::uint64 useCounter{ 0 };
+
+    // render threads -> message thread
+    juce::CriticalSection renderedLock;
+    std::vector<Rendered> rendered;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetThumbnailCache)
+};
@@ -19,6 +19,18 @@ VASVFProcessorUpdater<SampleType>::VASVFProcessorUpdater(EQParameterReference& r
     paramRef.gain .addListener(this);
     paramRef.q    .addListener(this);
     paramRef.autoq.addListener(this);
+    paramRef.morph.addListener(this);
+
+    paramRef.dynamic  .addListener(this);
+    paramRef.sidechain.addListener(this);
+    paramRef.threshold.addListener(this);
+    paramRef.ratio    .addListener(this);
+    paramRef.attack   .addListener(this);
+    paramRef.release  .addListener(this);
+
+    paramRef.smoothing.addListener(this);
+
+    publishParameters();
 }
 
 template<typename SampleType>
@@ -29,28 +41,78 @@ VASVFProcessorUpdater<SampleType>::~VASVFProcessorUpdater()
     paramRef.gain .removeListener(this);
     paramRef.q    .removeListener(this);
     paramRef.autoq.removeListener(this);
+    paramRef.morph.removeListener(this);
+
+    paramRef.dynamic  .removeListener(this);
+    paramRef.sidechain.removeListener(this);
+    paramRef.threshold.removeListener(this);
+    paramRef.ratio    .removeListener(this);
+    paramRef.attack   .removeListener(this);
+    paramRef.release  .removeListener(this);
+
+    paramRef.smoothing.removeListener(this);
 }
 
 template<typename SampleType>
 void VASVFProcessorUpdater<SampleType>::updateProcessor() noexcept
 {
-    if (requiresUpdate.load())
-    {
-        processor.setType(static_cast<gedd::dsp::VASVF::FilterType>(paramRef.type.getIndex()));
-        processor.setFrequency(paramRef.freq.get());
-        processor.setGain(paramRef.gain.get());
-        processor.setQ(paramRef.q.get());
-        processor.setAutoQ(paramRef.autoq.get());
-
-        requiresUpdate.store(false);
-    }
+    snapshots.forEachChanged([this](int band, const VASVFBandParameters& p)
+        {
+            juce::ignoreUnused(band);
+            applyParameters(p);
+        });
 }
 
 template<typename SampleType>
 void VASVFProcessorUpdater<SampleType>::parameterValueChanged(int parameterIndex, float newValue)
 {
     juce::ignoreUnused(parameterIndex, newValue);
-    requiresUpdate.store(true);
+    publishParameters();
+}
+
+template<typename SampleType>
+void VASVFProcessorUpdater<SampleType>::publishParameters() noexcept
+{
+    // read by whichever writer publishes, after every change it has to cover
+    snapshots.store(0, [this](VASVFBandParameters& p)
+        {
+            p.type  = paramRef.type.getIndex();
+            p.freq  = paramRef.freq.get();
+            p.gain  = paramRef.gain.get();
+            p.q     = paramRef.q.get();
+            p.autoq = paramRef.autoq.get();
+            p.morph = paramRef.morph.get();
+
+            p.dynamic   = paramRef.dynamic.get();
+            p.sidechain = paramRef.sidechain.get();
+            p.threshold = paramRef.threshold.get();
+            p.ratio     = paramRef.ratio.get();
+            p.attack    = paramRef.attack.get();
+            p.release   = paramRef.release.get();
+
+            p.smoothing = paramRef.smoothing.get();
+        });
+}
+
+template<typename SampleType>
+void VASVFProcessorUpdater<SampleType>::applyParameters(const VASVFBandParameters& p) noexcept
+{
+    // first, so targets set below ramp over the new time
+    processor.setRampDurationSeconds(p.smoothing);
+
+    processor.setType(static_cast<gedd::dsp::VASVF::FilterType>(p.type));
+    processor.setFrequency(p.freq);
+    processor.setGain(p.gain);
+    processor.setQ(p.q);
+    processor.setAutoQ(p.autoq);
+    processor.setMorph(p.morph);
+
+    processor.setDynamicsEnabled(p.dynamic);
+    processor.setSidechainEnabled(p.sidechain);
+    processor.setThreshold(p.threshold);
+    processor.setRatio(p.ratio);
+    processor.setAttack(p.attack);
+    processor.setRelease(p.release);
 }
 
 template<typename SampleType>
@@ -12,7 +12,25 @@
 #include <JuceHeader.h>
 #include "ParameterReference.h"
 #include "VASVFProcessor.h"
+#include "BandSnapshots.h"
 
+// Everything one band of the processor needs, read as a set
+struct VASVFBandParameters
+{
+    int type{ 0 };
+    float freq{ 0.0f }, gain{ 0.0f }, q{ 0.0f }, morph{ 0.0f };
+    bool autoq{ false };
+
+    bool dynamic{ false }, sidechain{ false };
+    float threshold{ 0.0f }, ratio{ 0.0f }, attack{ 0.0f }, release{ 0.0f };
+
+    float smoothing{ 0.0f };
+};
+
+/*
+    Listeners publish a whole band whenever any of its parameters changes, the audio
+    thread applies only the bands flagged since the last block. See gedd::BandSnapshots.
+*/
 template<typename SampleType>
 class VASVFProcessorUpdater : private juce::RangedAudioParameter::Listener
 {
@@ -21,6 +39,7 @@ public:
     
     ~VASVFProcessorUpdater() override;
 
+    // audio thread
     void updateProcessor() noexcept;
 
 private:
@@ -29,9 +48,14 @@ private:
     // Unused pure virtual function
     void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override; // rangedAudioParameter::Listener
 
+    // any thread
+    void publishParameters() noexcept;
+
+    void applyParameters(const VASVFBandParameters& p) noexcept;
+
     gedd::dsp::VASVFProcessor<SampleType>& processor;
     EQParameterReference& paramRef;
-    std::atomic<bool> requiresUpdate{ true };
+    gedd::BandSnapshots<VASVFBandParameters> snapshots;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VASVFProcessorUpdater)
 };
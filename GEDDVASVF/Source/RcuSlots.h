@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    RcuSlots.h
+    Created: 19 Oct 2026 10:24:09pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+namespace gedd
+{
+    /*
+        Read-copy-update publication through a fixed pool of slots.
+
+        The writer fills a free slot and publishes it with one atomic pointer swap.
+        The reader picks up the latest slot and may keep using it for as long as it
+        likes. It marks the slot it holds, and the one it is about to take, so the
+        writer never reuses either. Every other slot, including the one retired by a
+        publish, is free again immediately, so reclaiming needs no locks and no
+        deferred frees. With numSlots >= 4 the writer always finds a free slot.
+
+        One writer thread and one reader thread. Slots are constructed up front, T may
+        own storage that is reused from one publish to the next.
+    */
+    template <typename T, int numSlots = 4>
+    class RcuSlots
+    {
+    public:
+        static_assert(numSlots >= 4, "one published, two marked by the reader and one to write");
+
+        RcuSlots() = default;
+
+        // writer, a slot neither published nor held by the reader, still holding whatever it last held
+        T& beginWrite() noexcept
+        {
+            const auto* published = latest.load(std::memory_order_relaxed);
+            const auto* held = reading.load(std::memory_order_seq_cst);
+            const auto* taking = candidate.load(std::memory_order_seq_cst);
+
+            for (auto& slot : slots)
+            {
+                if (&slot != published && &slot != held && &slot != taking)
+                {
+                    writing = &slot;
+                    break;
+                }
+            }
+
+            jassert(writing != nullptr);
+            return *writing;
+        }
+
+        // writer, the old latest slot is retired
+        void publish() noexcept
+        {
+            jassert(writing != nullptr);
+
+            latest.exchange(writing, std::memory_order_seq_cst);
+            publishCount.fetch_add(1, std::memory_order_release);
+
+            writing = nullptr;
+        }
+
+        // reader, the latest slot if anything was published since the last call, otherwise nullptr
+        const T* acquire() noexcept
+        {
+            const auto count = publishCount.load(std::memory_order_acquire);
+
+            if (count == lastCount)
+                return nullptr;
+
+            // hazard pointer, re-checked so the writer can't have picked the slot before seeing it marked.
+            // The held slot stays marked until the new one is safe
+            for (auto attempt = 0; attempt != maxAttempts; ++attempt)
+            {
+                const auto* next = latest.load(std::memory_order_seq_cst);
+                candidate.store(next, std::memory_order_seq_cst);
+
+                if (latest.load(std::memory_order_seq_cst) == next)
+                {
+                    reading.store(next, std::memory_order_seq_cst);
+                    candidate.store(nullptr, std::memory_order_seq_cst);
+
+                    lastCount = count;
+                    current = next;
+                    return current;
+                }
+            }
+
+            // the writer kept publishing, stay on the held slot and try again next time
+            candidate.store(nullptr, std::memory_order_seq_cst);
+            return nullptr;
+        }
+
+        // reader, the slot last returned by acquire(), nullptr before the first publish
+        const T* getCurrent() const noexcept { return current; }
+
+    private:
+        static constexpr int maxAttempts{ 4 };
+
+        std::array<T, static_cast<size_t>(numSlots)> slots;
+
+        std::atomic<T*> latest{ nullptr };
+        std::atomic<const T*> reading{ nullptr }, candidate{ nullptr };
+        std::atomic<juce::uint32> publishCount{ 0 };
+
+        T* writing{ nullptr };              // writer only
+        const T* current{ nullptr };        // reader only
+        juce::uint32 lastCount{ 0 };        // reader only
+
+        JUCE_DECLARE_NON_COPYABLE(RcuSlots)
+    };
+
+}   // namespace gedd
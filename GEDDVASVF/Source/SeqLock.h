@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    SeqLock.h
+    Created: 19 Oct 2026 6:40:18pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+namespace gedd
+{
+    /*
+        Single writer sequence lock for small trivially copyable snapshots.
+
+        The writer never waits, it bumps the sequence to odd, writes and bumps it
+        back to even. A reader copies the value and retries if the sequence was
+        odd or moved while it was copying, so it only ever returns a consistent
+        value. The payload is stored as relaxed atomic words, no data races.
+
+        getSequence() lets readers skip work when nothing has been published.
+    */
+    template <typename T>
+    class SeqLock
+    {
+    public:
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLock needs a trivially copyable type");
+
+        SeqLock() noexcept
+        {
+            for (auto& w : words)
+                w.store(0, std::memory_order_relaxed);
+        }
+
+        explicit SeqLock(const T& initialValue) noexcept : SeqLock()
+        {
+            store(initialValue);
+        }
+
+        // writer
+        void store(const T& value) noexcept
+        {
+            std::array<uint64_t, numWords> buffer{};
+            std::memcpy(buffer.data(), &value, sizeof(T));
+
+            const auto seq = sequence.load(std::memory_order_relaxed);
+
+            sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (size_t i = 0; i != numWords; ++i)
+                words[i].store(buffer[i], std::memory_order_relaxed);
+
+            sequence.store(seq + 2, std::memory_order_release);
+        }
+
+        // reader, false if the writer was busy
+        bool tryLoad(T& value) const noexcept
+        {
+            const auto before = sequence.load(std::memory_order_acquire);
+
+            if ((before & 1) != 0)
+                return false;
+
+            std::array<uint64_t, numWords> buffer;
+
+            for (size_t i = 0; i != numWords; ++i)
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) != before)
+                return false;
+
+            std::memcpy(&value, buffer.data(), sizeof(T));
+            return true;
+        }
+
+        // reader, retries a bounded number of times
+        bool load(T& value, int maxAttempts = 64) const noexcept
+        {
+            for (auto i = 0; i != maxAttempts; ++i)
+                if (tryLoad(value))
+                    return true;
+
+            return false;
+        }
+
+        // even while idle, changes on every store()
+        uint32_t getSequence() const noexcept { return sequence.load(std::memory_order_acquire); }
+
+    private:
+        static constexpr size_t numWords{ (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t) };
+
+        std::array<std::atomic<uint64_t>, numWords> words;
+        std::atomic<uint32_t> sequence{ 0 };
+
+        JUCE_DECLARE_NON_COPYABLE(SeqLock)
+    };
+
+}   // namespace gedd
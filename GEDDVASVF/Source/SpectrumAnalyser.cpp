@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.cpp
+    Created: 19 Oct 2026 7:26:52pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyser.h"
+
+namespace gedd
+{
+namespace dsp
+{
+    SpectrumAnalyser::SpectrumAnalyser()
+    {
+        ring.resize(static_cast<size_t>(fifoSize));
+
+        history.resize(static_cast<size_t>(fftSize));
+        fftData.resize(static_cast<size_t>(2 * fftSize));
+        power.resize(static_cast<size_t>(fftSize / 2 + 1));
+
+        // a full scale sine reads 0 dB through the hann window
+        levelScale = 4.0f / static_cast<float>(fftSize);
+    }
+
+    void SpectrumAnalyser::setActive(bool shouldBeActive) noexcept
+    {
+        if (shouldBeActive && !active.load())
+            resetRequested = true;
+
+        active = shouldBeActive;
+    }
+
+    void SpectrumAnalyser::setAveragingTime(float seconds) noexcept
+    {
+        jassert(seconds >= 0.0f);
+
+        averagingTime = seconds;
+    }
+
+    void SpectrumAnalyser::prepare(const juce::dsp::ProcessSpec& spec) noexcept
+    {
+        jassert(spec.sampleRate > 0);
+
+        // the analysis thread may be running, it clears its own state
+        sampleRate = spec.sampleRate;
+        resetRequested = true;
+    }
+
+    bool SpectrumAnalyser::analyse()
+    {
+        if (resetRequested.exchange(false))
+        {
+            // finishedRead() rather than reset(), the audio thread may be writing
+            fifo.finishedRead(fifo.getNumReady());
+
+            std::fill(history.begin(), history.end(), 0.0f);
+            std::fill(power.begin(), power.end(), 0.0f);
+        }
+
+        auto numReady = fifo.getNumReady();
+
+        if (numReady > maxBacklog)
+        {
+            const auto numToDrop = (numReady - maxBacklog) / hopSize * hopSize;
+
+            fifo.finishedRead(numToDrop);
+            numReady -= numToDrop;
+        }
+
+        const auto numFrames = numReady / hopSize;
+
+        for (auto frame = 0; frame != numFrames; ++frame)
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToRead(hopSize, start1, size1, start2, size2);
+
+            // history is kept oldest sample first, so the frame can be windowed in place
+            std::move(history.begin() + hopSize, history.end(), history.begin());
+
+            auto* dest = history.data() + (fftSize - hopSize);
+            std::copy(ring.begin() + start1, ring.begin() + start1 + size1, dest);
+            std::copy(ring.begin() + start2, ring.begin() + start2 + size2, dest + size1);
+
+            fifo.finishedRead(size1 + size2);
+
+            processFrame();
+        }
+
+        return numFrames > 0;
+    }
+
+    void SpectrumAnalyser::processFrame()
+    {
+        std::copy(history.begin(), history.end(), fftData.begin());
+
+        window.multiplyWithWindowingTable(fftData.data(), static_cast<size_t>(fftSize));
+        fft.performFrequencyOnlyForwardTransform(fftData.data());
+
+        // one pole average per hop
+        const auto hopSeconds = static_cast<double>(hopSize) / sampleRate.load();
+        const auto time = static_cast<double>(averagingTime.load());
+        const auto alpha = time > 0.0 ? static_cast<float>(std::exp(-hopSeconds / time)) : 0.0f;
+
+        for (size_t bin = 0; bin != power.size(); ++bin)
+        {
+            const auto magnitude = fftData[bin] * levelScale;
+
+            power[bin] = alpha * power[bin] + (1.0f - alpha) * magnitude * magnitude;
+        }
+    }
+
+    void SpectrumAnalyser::getLevels(const juce::NormalisableRange<double>& range, float* levelsDecibels, int numBins) const
+    {
+        jassert(numBins > 1);
+
+        const auto binWidth = sampleRate.load() / static_cast<double>(fftSize);
+        const auto lastBin = static_cast<int>(power.size()) - 1;
+        const auto step = 1.0 / static_cast<double>(numBins - 1);
+
+        for (auto i = 0; i != numBins; ++i)
+        {
+            const auto proportion = static_cast<double>(i) * step;
+
+            const auto low = range.convertFrom0to1(juce::jmax(0.0, proportion - 0.5 * step)) / binWidth;
+            const auto high = range.convertFrom0to1(juce::jmin(1.0, proportion + 0.5 * step)) / binWidth;
+
+            const auto first = juce::jlimit(0, lastBin, static_cast<int>(std::ceil(low)));
+            const auto last = juce::jlimit(0, lastBin, static_cast<int>(std::floor(high)));
+
+            auto p = 0.0f;
+
+            if (last >= first)
+            {
+                // the loudest fft bin inside the display bin, so narrow peaks survive
+                for (auto bin = first; bin <= last; ++bin)
+                    p = juce::jmax(p, power[static_cast<size_t>(bin)]);
+            }
+            else
+            {
+                // display bins narrower than the fft bins at the low end, interpolate
+                const auto x = juce::jlimit(0.0, static_cast<double>(lastBin), range.convertFrom0to1(proportion) / binWidth);
+                const auto bin = juce::jmin(static_cast<int>(x), lastBin - 1);
+                const auto t = static_cast<float>(x - static_cast<double>(bin));
+
+                p = power[static_cast<size_t>(bin)] + t * (power[static_cast<size_t>(bin + 1)] - power[static_cast<size_t>(bin)]);
+            }
+
+            levelsDecibels[i] = 10.0f * std::log10(juce::jmax(p, 1.0e-20f));
+        }
+    }
+
+}   // namespace dsp
+}   // namespace gedd
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.h
+    Created: 19 Oct 2026 7:26:52pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+namespace gedd
+{
+namespace dsp
+{
+    /*
+        Audio side tap plus analysis engine for a spectrum display.
+
+        The audio thread only mixes to mono and pushes into a wait-free single
+        producer / single consumer fifo, and does nothing at all while inactive.
+        Windowing, the FFT, averaging and log frequency binning all happen on
+        whichever thread calls analyse() and getLevels(), never the audio thread.
+    */
+    class SpectrumAnalyser
+    {
+    public:
+        static constexpr int fftOrder{ 11 };
+        static constexpr int fftSize{ 1 << fftOrder };
+        static constexpr int hopSize{ fftSize / 4 };
+
+        SpectrumAnalyser();
+
+        // while inactive the audio thread pushes nothing, any thread
+        void setActive(bool shouldBeActive) noexcept;
+
+        bool isActive() const noexcept { return active.load(std::memory_order_relaxed); }
+
+        // exponential averaging time of the power spectrum, any thread
+        void setAveragingTime(float seconds) noexcept;
+
+        float getAveragingTime() const noexcept { return averagingTime.load(); }
+
+        double getSampleRate() const noexcept { return sampleRate.load(); }
+
+        // Dsp methods
+        void prepare(const juce::dsp::ProcessSpec& spec) noexcept;
+
+        // audio thread, drops input if the fifo is full
+        template<typename BlockType>
+        void pushSamples(const BlockType& block) noexcept
+        {
+            if (!active.load(std::memory_order_relaxed))
+                return;
+
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+            const auto numChannels = block.getNumChannels();
+
+            if (numChannels == 0)
+                return;
+
+            const auto scale = 1.0f / static_cast<float>(numChannels);
+
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+            auto write = [&](int destStart, int num, int sourceStart)
+            {
+                for (auto i = 0; i != num; ++i)
+                {
+                    auto sum = 0.0f;
+
+                    for (size_t channel = 0; channel != numChannels; ++channel)
+                        sum += static_cast<float>(block.getSample(static_cast<int>(channel), sourceStart + i));
+
+                    ring[static_cast<size_t>(destStart + i)] = sum * scale;
+                }
+            };
+
+            write(start1, size1, 0);
+            write(start2, size2, size1);
+
+            fifo.finishedWrite(size1 + size2);
+        }
+
+        // analysis thread, consumes whole hops, returns false if there was no new frame
+        bool analyse();
+
+        // analysis thread, averaged level in dB over numBins points evenly spaced in range's 0..1
+        void getLevels(const juce::NormalisableRange<double>& range, float* levelsDecibels, int numBins) const;
+
+    private:
+        void processFrame();
+
+        static constexpr int fifoSize{ 8 * fftSize };
+        static constexpr int maxBacklog{ 4 * hopSize };  // older input is dropped to keep the display current
+
+        std::atomic<bool> active{ false }, resetRequested{ true };
+        std::atomic<double> sampleRate{ 44100.0 };
+        std::atomic<float> averagingTime{ 0.15f };
+
+        // audio -> analysis
+        juce::AbstractFifo fifo{ fifoSize };
+        std::vector<float> ring;
+
+        // analysis thread only
+        juce::dsp::FFT fft{ fftOrder };
+        juce::dsp::WindowingFunction<float> window{ static_cast<size_t>(fftSize), juce::dsp::WindowingFunction<float>::hann, false };
+        std::vector<float> history, fftData, power;
+        float levelScale{ 1.0f };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyser)
+    };
+
+}   // namespace dsp
+}   // namespace gedd
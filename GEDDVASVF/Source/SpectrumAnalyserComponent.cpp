@@ -0,0 +1,226 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyserComponent.cpp
+    Created: 19 Oct 2026 7:58:03pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyserComponent.h"
+
+//==============================================================================
+SpectrumAnalyserComponent::SpectrumAnalyserComponent()
+{
+    setOpaque(false);
+    setInterceptsMouseClicks(false, false);
+    setPaintingIsUnclipped(true);
+    setRepaintsOnMouseActivity(false);
+
+    setColour(preSpectrumColourID, juce::Colours::grey.withAlpha(0.35f));
+    setColour(postSpectrumColourID, juce::Colours::lightblue.withAlpha(0.6f));
+
+    // the display thread is only used once there is an analyser
+    startTimerHz(maxFrameRate.load());
+}
+
+SpectrumAnalyserComponent::~SpectrumAnalyserComponent()
+{
+    // waits for an analysis in progress
+    displayThread->removeTimeSliceClient(this);
+
+    if (pre != nullptr)
+        pre->setActive(false);
+
+    if (post != nullptr)
+        post->setActive(false);
+}
+
+void SpectrumAnalyserComponent::paint(juce::Graphics& g)
+{
+    const auto& paths = results.getReadBuffer();
+
+    if (showPre && !paths.pre.isEmpty())
+    {
+        g.setColour(findColour(preSpectrumColourID));
+        g.fillPath(paths.pre);
+    }
+
+    if (showPost && !paths.post.isEmpty())
+    {
+        g.setColour(findColour(postSpectrumColourID));
+        g.strokePath(paths.post, juce::PathStrokeType(1.0f));
+    }
+}
+
+void SpectrumAnalyserComponent::resized()
+{
+    postRequest();
+}
+
+void SpectrumAnalyserComponent::setAnalysers(gedd::dsp::SpectrumAnalyser* newPre, gedd::dsp::SpectrumAnalyser* newPost)
+{
+    // swapped while the display thread can't be using them
+    displayThread->removeTimeSliceClient(this);
+
+    if (pre != nullptr && pre != newPre)
+        pre->setActive(false);
+
+    if (post != nullptr && post != newPost)
+        post->setActive(false);
+
+    pre = newPre;
+    post = newPost;
+
+    if (pre != nullptr)
+        pre->setActive(showPre);
+
+    if (post != nullptr)
+        post->setActive(showPost);
+
+    if (pre != nullptr || post != nullptr)
+        displayThread->addClient(this);
+}
+
+void SpectrumAnalyserComponent::setShowPreSpectrum(bool shouldShow)
+{
+    showPre = shouldShow;
+
+    // a hidden spectrum costs the audio thread nothing
+    if (pre != nullptr)
+        pre->setActive(showPre);
+
+    repaint();
+}
+
+void SpectrumAnalyserComponent::setShowPostSpectrum(bool shouldShow)
+{
+    showPost = shouldShow;
+
+    if (post != nullptr)
+        post->setActive(showPost);
+
+    repaint();
+}
+
+void SpectrumAnalyserComponent::setFrequencyNormalisableRange(juce::NormalisableRange<double> r)
+{
+    if (r.getRange().getLength() <= 0) return;
+
+    frequencyRange = r;
+    postRequest();
+}
+
+void SpectrumAnalyserComponent::setDecibelRange(juce::Range<double> r)
+{
+    jassert(r.getStart() < r.getEnd());
+
+    decibelRange = r;
+    postRequest();
+}
+
+void SpectrumAnalyserComponent::setDecibelNormalisableRange(juce::NormalisableRange<double> r)
+{
+    if (r.getRange().getLength() <= 0) return;
+
+    setDecibelRange(r.getRange());
+}
+
+void SpectrumAnalyserComponent::setMaxFrameRate(int framesPerSecond)
+{
+    jassert(framesPerSecond > 0);
+
+    maxFrameRate = framesPerSecond;
+    startTimerHz(framesPerSecond);
+}
+
+void SpectrumAnalyserComponent::postRequest()
+{
+    auto& r = requests.getWriteBuffer();
+
+    r.frequencyRange = frequencyRange;
+    r.decibelRange = decibelRange;
+    r.bounds = getLocalBounds();
+
+    requests.publish();
+}
+
+void SpectrumAnalyserComponent::timerCallback()
+{
+    if (results.acquire())
+        repaint();
+}
+
+//==============================================================================
+int SpectrumAnalyserComponent::useTimeSlice()
+{
+    const auto frameMilliseconds = 1000 / maxFrameRate.load();
+
+    const auto requestChanged = requests.acquire();
+
+    if (requestChanged)
+        request = requests.getReadBuffer();
+
+    const auto preChanged = pre != nullptr && pre->analyse();
+    const auto postChanged = post != nullptr && post->analyse();
+
+    if (request.bounds.getWidth() < 2 || request.bounds.getHeight() < 1)
+        return frameMilliseconds;
+
+    if (!requestChanged && !preChanged && !postChanged)
+        return frameMilliseconds;
+
+    auto& paths = results.getWriteBuffer();
+
+    if (pre != nullptr)
+        createSpectrumPath(*pre, paths.pre, true);
+    else
+        paths.pre.clear();
+
+    if (post != nullptr)
+        createSpectrumPath(*post, paths.post, false);
+    else
+        paths.post.clear();
+
+    results.publish();
+
+    return frameMilliseconds;
+}
+
+void SpectrumAnalyserComponent::createSpectrumPath(gedd::dsp::SpectrumAnalyser& analyser, juce::Path& path, bool closed)
+{
+    // one point every other pixel
+    const auto bounds = request.bounds.toFloat();
+    const auto numPoints = juce::jmax(2, request.bounds.getWidth() / 2);
+
+    levels.resize(static_cast<size_t>(numPoints));
+    analyser.getLevels(request.frequencyRange, levels.data(), numPoints);
+
+    const auto dbFloor = static_cast<float>(request.decibelRange.getStart());
+    const auto dbScale = 1.0f / static_cast<float>(request.decibelRange.getLength());
+    const auto xScale = bounds.getWidth() / static_cast<float>(numPoints - 1);
+
+    path.clear();
+    path.preallocateSpace(3 * numPoints + 6);
+
+    for (auto i = 0; i != numPoints; ++i)
+    {
+        const auto proportion = juce::jlimit(0.0f, 1.0f, (levels[static_cast<size_t>(i)] - dbFloor) * dbScale);
+
+        const auto xPos = bounds.getX() + static_cast<float>(i) * xScale;
+        const auto yPos = bounds.getBottom() - proportion * bounds.getHeight();
+
+        if (i == 0)
+            path.startNewSubPath(xPos, yPos);
+        else
+            path.lineTo(xPos, yPos);
+    }
+
+    if (closed)
+    {
+        path.lineTo(bounds.getRight(), bounds.getBottom());
+        path.lineTo(bounds.getX(), bounds.getBottom());
+        path.closeSubPath();
+    }
+}
@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyserComponent.h
+    Created: 19 Oct 2026 7:58:03pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SpectrumAnalyser.h"
+#include "CommonFunctions.h"
+#include "TripleBuffer.h"
+
+//==============================================================================
+/*
+* Pre and post filter spectra, drawn behind the response trace.
+*
+* The analysers are fed by the audio thread, analysis and path building run on
+* the shared display thread and finished paths are picked up once per frame.
+* Spectra are in dBFS, on the same decibel range as the grid they are drawn behind.
+*/
+class SpectrumAnalyserComponent : public juce::Component,
+                                  private juce::Timer,
+                                  private juce::TimeSliceClient
+{
+public:
+    enum ColourIDs
+    {
+        preSpectrumColourID     = 0x8800200,
+        postSpectrumColourID    = 0x8800201
+    };
+
+    SpectrumAnalyserComponent();
+
+    ~SpectrumAnalyserComponent() override;
+
+    void paint(juce::Graphics& g) override;
+
+    void resized() override;
+
+    // either may be nullptr, they are activated while attached and have to outlive this component
+    void setAnalysers(gedd::dsp::SpectrumAnalyser* newPre, gedd::dsp::SpectrumAnalyser* newPost);
+
+    // setters
+    void setShowPreSpectrum(bool shouldShow);
+
+    void setShowPostSpectrum(bool shouldShow);
+
+    void setFrequencyNormalisableRange(juce::NormalisableRange<double> r);
+
+    void setDecibelRange(juce::Range<double> r);
+
+    void setDecibelNormalisableRange(juce::NormalisableRange<double> r);
+
+    void setMaxFrameRate(int framesPerSecond);
+
+    // getters
+    bool getShowPreSpectrum() const { return showPre; }
+
+    bool getShowPostSpectrum() const { return showPost; }
+
+    juce::NormalisableRange<double> getFrequencyNormalisableRange() const { return frequencyRange; }
+
+    juce::Range<double> getDecibelRange() const { return decibelRange; }
+
+    int getMaxFrameRate() const { return maxFrameRate.load(); }
+
+private:
+    struct SpectrumRequest
+    {
+        juce::NormalisableRange<double> frequencyRange;
+        juce::Range<double> decibelRange;
+        juce::Rectangle<int> bounds;
+    };
+
+    struct SpectrumPaths
+    {
+        juce::Path pre, post;
+    };
+
+    // message thread
+    void postRequest();
+
+    void timerCallback() override;
+
+    // display thread
+    int useTimeSlice() override;
+
+    void createSpectrumPath(gedd::dsp::SpectrumAnalyser& analyser, juce::Path& path, bool closed);
+
+    //============================================================
+    juce::NormalisableRange<double> frequencyRange{ gedd::createFrequencyRange(20.0, 18000.0) };
+    juce::Range<double> decibelRange{ -24.0, 24.0 };
+
+    bool showPre{ true };
+    bool showPost{ true };
+    std::atomic<int> maxFrameRate{ 30 };
+
+    gedd::dsp::SpectrumAnalyser* pre{ nullptr };
+    gedd::dsp::SpectrumAnalyser* post{ nullptr };
+
+    // message thread -> display thread
+    gedd::TripleBuffer<SpectrumRequest> requests;
+
+    // display thread -> message thread
+    gedd::TripleBuffer<SpectrumPaths> results;
+
+    // display thread only
+    SpectrumRequest request;
+    std::vector<float> levels;
+
+    juce::SharedResourcePointer<gedd::DisplayThread> displayThread;
+
+    //============================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyserComponent)
+};
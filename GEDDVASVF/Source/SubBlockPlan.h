@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    SubBlockPlan.h
+    Created: 19 Oct 2026 9:58:20pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+namespace gedd
+{
+    /*
+        Where to split a block so parameter changes land close to where they happen.
+
+        Splits come from timestamped events plus a regular split every maxSubBlockSize
+        samples, so smoothed parameters move in time rather than once per host buffer.
+        Events closer than minSubBlockSize to the previous split are merged into it,
+        which bounds the per sub block overhead however dense the automation is.
+
+        prepare() sizes everything, building a plan never allocates. A block larger
+        than prepared gets as many splits as were reserved, the last sub block then
+        takes the rest of it.
+    */
+    class SubBlockPlan
+    {
+    public:
+        SubBlockPlan() = default;
+
+        // not on the audio thread
+        void prepare(int maximumBlockSize, int newMaxSubBlockSize, int newMinSubBlockSize)
+        {
+            jassert(newMinSubBlockSize > 0 && newMinSubBlockSize <= newMaxSubBlockSize);
+
+            maxBlockSize = maximumBlockSize;
+            maxSubBlockSize = newMaxSubBlockSize;
+            minSubBlockSize = newMinSubBlockSize;
+
+            // at most one split per minimum sub block, plus the end
+            const auto capacity = static_cast<size_t>(maximumBlockSize / minSubBlockSize + 2);
+
+            events.clear();
+            events.reserve(capacity);
+            boundaries.clear();
+            boundaries.reserve(capacity);
+        }
+
+        // audio thread, offsets in samples from the start of the block, in any order
+        void addEvent(int sampleOffset) noexcept
+        {
+            // the rest are merged away anyway
+            if (events.size() == events.capacity())
+                return;
+
+            events.insert(std::upper_bound(events.begin(), events.end(), sampleOffset), sampleOffset);
+        }
+
+        // audio thread, consumes the events
+        void build(int numSamples) noexcept
+        {
+            jassert(maxSubBlockSize > 0);
+
+            boundaries.clear();
+            boundaries.push_back(0);
+
+            auto event = events.cbegin();
+            auto last = 0;
+
+            while (last < numSamples)
+            {
+                auto next = juce::jmin(last + maxSubBlockSize, numSamples);
+
+                // the first event far enough from the previous split
+                while (event != events.cend() && *event < last + minSubBlockSize)
+                    ++event;
+
+                if (event != events.cend() && *event < next)
+                    next = *event;
+
+                // nor too close to the end of the block
+                if (next < numSamples && numSamples - next < minSubBlockSize)
+                    next = numSamples;
+
+                // out of reserved splits, only when the host block is larger than prepared
+                if (boundaries.size() + 1 == boundaries.capacity())
+                    next = numSamples;
+
+                boundaries.push_back(next);
+                last = next;
+            }
+
+            events.clear();
+        }
+
+        int getNumSubBlocks() const noexcept { return static_cast<int>(boundaries.size()) - 1; }
+
+        int getStart(int index) const noexcept { return boundaries[static_cast<size_t>(index)]; }
+
+        int getLength(int index) const noexcept { return boundaries[static_cast<size_t>(index) + 1] - boundaries[static_cast<size_t>(index)]; }
+
+        int getMaxSubBlockSize() const noexcept { return maxSubBlockSize; }
+
+        int getMinSubBlockSize() const noexcept { return minSubBlockSize; }
+
+    private:
+        int maxBlockSize{ 0 }, maxSubBlockSize{ 0 }, minSubBlockSize{ 0 };
+
+        std::vector<int> events, boundaries;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SubBlockPlan)
+    };
+
+}   // namespace gedd
@@ -0,0 +1,371 @@
+/*
+  ==============================================================================
+
+    TraceAndGrid.h
+    Created: 20 Oct 2026 3:12:40am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CommonFunctions.h"
+#include "ParameterReference.h"
+#include "VASVFTraceComponent.h"
+#include "FrequencyDecibelGridOverlay.h"
+#include "SpectrumAnalyserComponent.h"
+#include "MeasuredResponseComponent.h"
+
+//==============================================================================
+/*
+* The response display: grid, spectrum, predicted trace and measured response
+* stacked in that order, with the range sliders and show toggles around them.
+* Only needs the parameters, so it can be used without the processor.
+*/
+class TraceAndGrid : public juce::Component
+{
+public:
+    // offscreenScale > 0 starts offscreen, see VASVFTraceComponent::setOffscreenScale()
+    TraceAndGrid(EQParameterReference& ref, double offscreenScale = 0.0)
+        : responseTrace(ref, offscreenScale)
+    {
+        // not buffered, the grid caches itself and every trace update would invalidate a cache here
+        setOpaque(true);
+        setInterceptsMouseClicks(false, true);
+        setPaintingIsUnclipped(true);
+        setRepaintsOnMouseActivity(false);
+
+        const auto frequencyRange = gedd::createFrequencyRange(20.0, 22000.0);
+        const auto decibelRange = juce::NormalisableRange<double>(-24.0, 24.0);
+
+        dbRangeSlider.setSliderStyle(juce::Slider::SliderStyle::TwoValueVertical);
+        dbRangeSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox, true, 0, 0);
+        dbRangeSlider.setRange(juce::Range<double>(-48.0, 48.0), 1.0);
+        dbRangeSlider.setMinAndMaxValues(-24.0, 24.0, juce::NotificationType::dontSendNotification);
+
+        // lambda
+        dbRangeSlider.onValueChange = [&] { 
+            // Validate
+            const auto min = dbRangeSlider.getMinValue();
+            const auto max = dbRangeSlider.getMaxValue();
+
+            if (min == max) return;
+
+            if (max < min)
+            {
+                dbRangeSlider.setMinValue(max, juce::NotificationType::dontSendNotification);
+                dbRangeSlider.setMaxValue(min, juce::NotificationType::dontSendNotification);
+            }
+
+            // update
+            const auto newRange = juce::NormalisableRange<double>(dbRangeSlider.getMinValue(), dbRangeSlider.getMaxValue());
+            responseTrace.setDecibelNormalisableRange(newRange);
+            grid.setDecibelNormalisableRange(newRange);
+            spectrum.setDecibelNormalisableRange(newRange);
+            measured.setDecibelNormalisableRange(newRange);
+
+            dbLabelBottom.setText(juce::String(static_cast<int>(min)), juce::NotificationType::dontSendNotification);
+            dbLabelTop.setText(juce::String(static_cast<int>(max)), juce::NotificationType::dontSendNotification);
+
+            if (onRangesChanged != nullptr)
+                onRangesChanged();
+        };
+
+        freqRangeSlider.setSliderStyle(juce::Slider::SliderStyle::TwoValueHorizontal);
+        freqRangeSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox, true, 0, 0);
+        freqRangeSlider.setNormalisableRange(gedd::createFrequencyRange(1.0, 22050.0, 1.0));
+        freqRangeSlider.setMinAndMaxValues(20.0, 18000.0, juce::NotificationType::dontSendNotification);
+
+        // lambda
+        freqRangeSlider.onValueChange = [&] {
+            // Validate
+            const auto min = freqRangeSlider.getMinValue();
+            const auto max = freqRangeSlider.getMaxValue();
+
+            if (min == max) return;
+
+            if (max < min)
+            {
+                freqRangeSlider.setMinValue(max, juce::NotificationType::dontSendNotification);
+                freqRangeSlider.setMaxValue(min, juce::NotificationType::dontSendNotification);
+            }
+
+            // Update
+            const auto newRange = gedd::createFrequencyRange(freqRangeSlider.getMinValue(), freqRangeSlider.getMaxValue());
+            responseTrace.setFrequencyNormalisableRange(newRange);
+            grid.setFrequencyNormalisableRange(newRange);
+            spectrum.setFrequencyNormalisableRange(newRange);
+            measured.setFrequencyNormalisableRange(newRange);
+
+            freqLabelLeft.setText(juce::String(static_cast<int>(min)), juce::NotificationType::dontSendNotification);
+            freqLabelRight.setText(juce::String(static_cast<int>(max)), juce::NotificationType::dontSendNotification);
+
+            if (onRangesChanged != nullptr)
+                onRangesChanged();
+        };
+
+        showMagnitudeToggle.setToggleState(responseTrace.getShowMagnitudeTrace(), juce::NotificationType::dontSendNotification);
+        showMagnitudeToggle.onStateChange = [&] {
+            responseTrace.setShowMagnitudeTrace(showMagnitudeToggle.getToggleState());
+            measured.setShowMagnitude(showMagnitudeToggle.getToggleState());
+        };
+
+        showPhaseToggle.setToggleState(responseTrace.getShowPhaseTrace(), juce::NotificationType::dontSendNotification);
+        showPhaseToggle.onStateChange = [&] {
+            responseTrace.setShowPhaseTrace(showPhaseToggle.getToggleState());
+            measured.setShowPhase(showPhaseToggle.getToggleState());
+        };
+
+        showGroupDelayToggle.setToggleState(responseTrace.getShowGroupDelayTrace(), juce::NotificationType::dontSendNotification);
+        showGroupDelayToggle.onStateChange = [&] {
+            responseTrace.setShowGroupDelayTrace(showGroupDelayToggle.getToggleState());
+        };
+
+        showPreSpectrumToggle.setToggleState(spectrum.getShowPreSpectrum(), juce::NotificationType::dontSendNotification);
+        showPreSpectrumToggle.onStateChange = [&] {
+            spectrum.setShowPreSpectrum(showPreSpectrumToggle.getToggleState());
+        };
+
+        showPostSpectrumToggle.setToggleState(spectrum.getShowPostSpectrum(), juce::NotificationType::dontSendNotification);
+        showPostSpectrumToggle.onStateChange = [&] {
+            spectrum.setShowPostSpectrum(showPostSpectrumToggle.getToggleState());
+        };
+
+        // the measured curves follow the predicted ones they are compared with
+        measureToggle.setToggleState(measured.isMeasuring(), juce::NotificationType::dontSendNotification);
+        measureToggle.onStateChange = [&] {
+            measured.setMeasuring(measureToggle.getToggleState());
+        };
+
+        responseTrace.setFrequencyNormalisableRange(frequencyRange);
+        responseTrace.setDecibelNormalisableRange(decibelRange);
+        grid.setFrequencyNormalisableRange(frequencyRange);
+        grid.setDecibelNormalisableRange(decibelRange);
+        grid.setColour(FrequencyDecibelGridOverlay::backgroundColourID, juce::Colours::black);
+        spectrum.setFrequencyNormalisableRange(frequencyRange);
+        spectrum.setDecibelNormalisableRange(decibelRange);
+        measured.setFrequencyNormalisableRange(frequencyRange);
+        measured.setDecibelNormalisableRange(decibelRange);
+        measured.setShowMagnitude(responseTrace.getShowMagnitudeTrace());
+        measured.setShowPhase(responseTrace.getShowPhaseTrace());
+
+        // labels
+        dbLabelTop.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
+        dbLabelTop.setJustificationType(juce::Justification::centred);
+        dbLabelTop.setText(juce::String(static_cast<int>(dbRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
+        dbLabelTop.setEditable(true, false, true);
+        dbLabelTop.onTextChange = [&] {
+            auto t = dbLabelTop.getText().trimStart();
+
+            while (t.startsWithChar('+'))
+                t = t.substring(1).trimStart();
+
+            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
+            auto valDbl = valStr.getDoubleValue();
+
+            if (valDbl > dbRangeSlider.getMinValue())
+            {
+                dbRangeSlider.setMaxValue(valDbl, juce::NotificationType::sendNotificationAsync);
+                dbLabelTop.setText(valStr, juce::NotificationType::dontSendNotification);
+            }
+            else
+            {
+                dbLabelTop.setText(juce::String(static_cast<int>(dbRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
+            }
+        };
+        
+        dbLabelBottom.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
+        dbLabelBottom.setJustificationType(juce::Justification::centred);
+        dbLabelBottom.setText(juce::String(static_cast<int>(dbRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
+        dbLabelBottom.setEditable(true, false, true);
+        dbLabelBottom.onTextChange = [&] {
+            auto t = dbLabelBottom.getText().trimStart();
+
+            while (t.startsWithChar('+'))
+                t = t.substring(1).trimStart();
+
+            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
+            auto valDbl = valStr.getDoubleValue();
+
+            if (valDbl < dbRangeSlider.getMaxValue())
+            {
+                dbRangeSlider.setMinValue(valDbl, juce::NotificationType::sendNotificationAsync);
+                dbLabelBottom.setText(valStr, juce::NotificationType::dontSendNotification);
+            }
+            else
+            {
+                dbLabelBottom.setText(juce::String(static_cast<int>(dbRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
+            }
+        };
+
+        freqLabelLeft.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
+        freqLabelLeft.setJustificationType(juce::Justification::centredRight);
+        freqLabelLeft.setText(juce::String(static_cast<int>(freqRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
+        freqLabelLeft.setEditable(true, false, true);
+        freqLabelLeft.onTextChange = [&] {
+            auto t = freqLabelLeft.getText().trimStart();
+
+            while (t.startsWithChar('+'))
+                t = t.substring(1).trimStart();
+
+            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
+            auto valDbl = valStr.getDoubleValue();
+
+            if (valDbl < freqRangeSlider.getMaxValue())
+            {
+                freqRangeSlider.setMinValue(valDbl, juce::NotificationType::sendNotificationAsync);
+                freqLabelLeft.setText(valStr, juce::NotificationType::dontSendNotification);
+            }
+            else
+            {
+                freqLabelLeft.setText(juce::String(static_cast<int>(freqRangeSlider.getMinValue())), juce::NotificationType::dontSendNotification);
+            }
+        };
+
+        freqLabelRight.setColour(juce::Label::ColourIds::textColourId, juce::Colours::azure);
+        freqLabelRight.setJustificationType(juce::Justification::centredLeft);
+        freqLabelRight.setText(juce::String(static_cast<int>(freqRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
+        freqLabelRight.setEditable(true, false, true);
+        freqLabelRight.onTextChange = [&] {
+            auto t = freqLabelRight.getText().trimStart();
+
+            while (t.startsWithChar('+'))
+                t = t.substring(1).trimStart();
+
+            auto valStr = t.initialSectionContainingOnly("0123456789.,-");
+            auto valDbl = valStr.getDoubleValue();
+
+            if (valDbl > freqRangeSlider.getMinValue())
+            {
+                freqRangeSlider.setMaxValue(valDbl, juce::NotificationType::sendNotificationAsync);
+                freqLabelRight.setText(valStr, juce::NotificationType::dontSendNotification);
+            }
+            else
+            {
+                freqLabelRight.setText(juce::String(static_cast<int>(freqRangeSlider.getMaxValue())), juce::NotificationType::dontSendNotification);
+            }
+        };
+
+        // add to component and make visible
+        addAndMakeVisible(grid);
+        addAndMakeVisible(spectrum);
+        addAndMakeVisible(responseTrace);
+        addAndMakeVisible(measured);
+
+        addAndMakeVisible(dbRangeSlider);
+        addAndMakeVisible(freqRangeSlider);
+        addAndMakeVisible(showMagnitudeToggle);
+        addAndMakeVisible(showPhaseToggle);
+        addAndMakeVisible(showGroupDelayToggle);
+        addAndMakeVisible(showPreSpectrumToggle);
+        addAndMakeVisible(showPostSpectrumToggle);
+        addAndMakeVisible(measureToggle);
+
+        addAndMakeVisible(dbLabelTop);
+        addAndMakeVisible(dbLabelBottom);
+        addAndMakeVisible(freqLabelLeft);
+        addAndMakeVisible(freqLabelRight);
+    }
+
+    void setStateSource(const gedd::SeqLock<gedd::dsp::VASVF::StateSnapshot>* source)
+    {
+        responseTrace.setStateSource(source);
+    }
+
+    void setAnalysers(gedd::dsp::SpectrumAnalyser* pre, gedd::dsp::SpectrumAnalyser* post)
+    {
+        spectrum.setAnalysers(pre, post);
+    }
+
+    void setTransferFunctionAnalyser(gedd::dsp::TransferFunctionAnalyser* analyser)
+    {
+        measured.setAnalyser(analyser);
+    }
+
+    // see VASVFTraceComponent::setOffscreenScale()
+    void setOffscreenScale(double scale)
+    {
+        responseTrace.setOffscreenScale(scale);
+    }
+
+    // offscreen the trace is only recomputed when asked
+    void updateTrace()
+    {
+        responseTrace.update();
+    }
+
+    // through the range sliders, so everything that follows them is updated
+    void setRanges(juce::Range<double> frequencies, juce::Range<double> decibels)
+    {
+        freqRangeSlider.setMinAndMaxValues(frequencies.getStart(), frequencies.getEnd(), juce::NotificationType::sendNotificationSync);
+        dbRangeSlider.setMinAndMaxValues(decibels.getStart(), decibels.getEnd(), juce::NotificationType::sendNotificationSync);
+    }
+
+    juce::Range<double> getFrequencyRange() const { return { freqRangeSlider.getMinValue(), freqRangeSlider.getMaxValue() }; }
+
+    juce::Range<double> getDecibelRange() const { return { dbRangeSlider.getMinValue(), dbRangeSlider.getMaxValue() }; }
+
+    // called whenever either range changes
+    std::function<void()> onRangesChanged;
+
+    void paint(juce::Graphics& g)
+    {
+        g.fillAll(juce::Colours::black);
+    }
+
+    void resized() override
+    {
+        const auto elHeight = 30;
+        const auto elWidth = 40;
+
+        auto bounds = getLocalBounds();
+
+        auto toggleRegion = bounds.removeFromTop(elHeight);
+
+        const auto toggleWidth = toggleRegion.getWidth() / 6;
+        showMagnitudeToggle.setBounds(toggleRegion.removeFromLeft(toggleWidth));
+        showPhaseToggle.setBounds(toggleRegion.removeFromLeft(toggleWidth));
+        showGroupDelayToggle.setBounds(toggleRegion.removeFromLeft(toggleWidth));
+        showPreSpectrumToggle.setBounds(toggleRegion.removeFromLeft(toggleWidth));
+        showPostSpectrumToggle.setBounds(toggleRegion.removeFromLeft(toggleWidth));
+        measureToggle.setBounds(toggleRegion);
+
+        // draw freq range
+        auto freqRangeRegion = bounds.removeFromTop(elHeight);
+
+        freqLabelLeft.setBounds(freqRangeRegion.removeFromLeft(elWidth));
+        freqLabelRight.setBounds(freqRangeRegion.removeFromRight(elWidth));
+        freqRangeSlider.setBounds(freqRangeRegion);
+
+        // draw db range
+        auto dbRangeRegion = bounds.removeFromLeft(elWidth);
+
+        dbLabelTop.setBounds(dbRangeRegion.removeFromTop(elHeight));
+        dbLabelBottom.setBounds(dbRangeRegion.removeFromBottom(elHeight));
+        dbRangeSlider.setBounds(dbRangeRegion);
+
+        // draw grid, spectrum, trace and measurement
+        grid.setBounds(bounds);
+        spectrum.setBounds(bounds);
+        responseTrace.setBounds(bounds);
+        measured.setBounds(bounds);
+    }
+
+private:
+    VASVFTraceComponent responseTrace;
+    FrequencyDecibelGridOverlay grid;
+    SpectrumAnalyserComponent spectrum;
+    MeasuredResponseComponent measured;
+
+    juce::Slider dbRangeSlider{ "dbRange" };
+    juce::Slider freqRangeSlider{ "freqRange" };
+    juce::ToggleButton showMagnitudeToggle{ "mag" };
+    juce::ToggleButton showPhaseToggle{ "phase" };
+    juce::ToggleButton showGroupDelayToggle{ "group delay" };
+    juce::ToggleButton showPreSpectrumToggle{ "pre" };
+    juce::ToggleButton showPostSpectrumToggle{ "post" };
+    juce::ToggleButton measureToggle{ "measure" };
+    juce::Label dbLabelTop, dbLabelBottom, freqLabelLeft, freqLabelRight;
+};
@@ -0,0 +1,188 @@
+/*
+  ==============================================================================
+
+    TransferFunctionAnalyser.cpp
+    Created: 19 Oct 2026 8:44:37pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "TransferFunctionAnalyser.h"
+
+namespace gedd
+{
+namespace dsp
+{
+    TransferFunctionAnalyser::TransferFunctionAnalyser()
+    {
+        inputRing.resize(static_cast<size_t>(fifoSize));
+        outputRing.resize(static_cast<size_t>(fifoSize));
+
+        inputHistory.resize(static_cast<size_t>(fftSize));
+        outputHistory.resize(static_cast<size_t>(fftSize));
+        inputData.resize(static_cast<size_t>(2 * fftSize));
+        outputData.resize(static_cast<size_t>(2 * fftSize));
+
+        const auto numBins = static_cast<size_t>(fftSize / 2 + 1);
+
+        sxx.resize(numBins);
+        syy.resize(numBins);
+        sxyReal.resize(numBins);
+        sxyImag.resize(numBins);
+    }
+
+    void TransferFunctionAnalyser::setActive(bool shouldBeActive) noexcept
+    {
+        if (shouldBeActive && !active.load())
+            resetRequested = true;
+
+        active = shouldBeActive;
+    }
+
+    void TransferFunctionAnalyser::setAveragingTime(float seconds) noexcept
+    {
+        jassert(seconds >= 0.0f);
+
+        averagingTime = seconds;
+    }
+
+    void TransferFunctionAnalyser::prepare(const juce::dsp::ProcessSpec& spec) noexcept
+    {
+        jassert(spec.sampleRate > 0);
+
+        sampleRate = spec.sampleRate;
+        resetRequested = true;
+    }
+
+    bool TransferFunctionAnalyser::analyse()
+    {
+        if (resetRequested.exchange(false))
+        {
+            fifo.finishedRead(fifo.getNumReady());
+
+            std::fill(inputHistory.begin(), inputHistory.end(), 0.0f);
+            std::fill(outputHistory.begin(), outputHistory.end(), 0.0f);
+
+            for (auto* v : { &sxx, &syy, &sxyReal, &sxyImag })
+                std::fill(v->begin(), v->end(), 0.0f);
+        }
+
+        auto numReady = fifo.getNumReady();
+
+        if (numReady > maxBacklog)
+        {
+            const auto numToDrop = (numReady - maxBacklog) / hopSize * hopSize;
+
+            fifo.finishedRead(numToDrop);
+            numReady -= numToDrop;
+        }
+
+        const auto numFrames = numReady / hopSize;
+
+        for (auto frame = 0; frame != numFrames; ++frame)
+        {
+            int s1, n1, s2, n2;
+            fifo.prepareToRead(hopSize, s1, n1, s2, n2);
+
+            auto append = [&](const std::vector<float>& ring, std::vector<float>& history)
+            {
+                std::move(history.begin() + hopSize, history.end(), history.begin());
+
+                auto* dest = history.data() + (fftSize - hopSize);
+                std::copy(ring.begin() + s1, ring.begin() + s1 + n1, dest);
+                std::copy(ring.begin() + s2, ring.begin() + s2 + n2, dest + n1);
+            };
+
+            append(inputRing, inputHistory);
+            append(outputRing, outputHistory);
+
+            fifo.finishedRead(n1 + n2);
+
+            processFrame();
+        }
+
+        return numFrames > 0;
+    }
+
+    void TransferFunctionAnalyser::processFrame()
+    {
+        std::copy(inputHistory.begin(), inputHistory.end(), inputData.begin());
+        std::copy(outputHistory.begin(), outputHistory.end(), outputData.begin());
+
+        window.multiplyWithWindowingTable(inputData.data(), static_cast<size_t>(fftSize));
+        window.multiplyWithWindowingTable(outputData.data(), static_cast<size_t>(fftSize));
+
+        // interleaved real / imaginary, bins 0 .. fftSize / 2
+        fft.performRealOnlyForwardTransform(inputData.data(), true);
+        fft.performRealOnlyForwardTransform(outputData.data(), true);
+
+        const auto hopSeconds = static_cast<double>(hopSize) / sampleRate.load();
+        const auto time = static_cast<double>(averagingTime.load());
+        const auto alpha = time > 0.0 ? static_cast<float>(std::exp(-hopSeconds / time)) : 0.0f;
+        const auto beta = 1.0f - alpha;
+
+        for (size_t bin = 0; bin != sxx.size(); ++bin)
+        {
+            const auto xr = inputData[2 * bin];
+            const auto xi = inputData[2 * bin + 1];
+            const auto yr = outputData[2 * bin];
+            const auto yi = outputData[2 * bin + 1];
+
+            // conj(X) Y
+            sxx[bin]     = alpha * sxx[bin]     + beta * (xr * xr + xi * xi);
+            syy[bin]     = alpha * syy[bin]     + beta * (yr * yr + yi * yi);
+            sxyReal[bin] = alpha * sxyReal[bin] + beta * (xr * yr + xi * yi);
+            sxyImag[bin] = alpha * sxyImag[bin] + beta * (xr * yi - xi * yr);
+        }
+    }
+
+    void TransferFunctionAnalyser::getResponse(const juce::NormalisableRange<double>& range, float* magnitudes, float* phases, float* coherence, int numBins) const
+    {
+        jassert(numBins > 1);
+
+        const auto binWidth = sampleRate.load() / static_cast<double>(fftSize);
+        const auto lastBin = static_cast<int>(sxx.size()) - 1;
+        const auto step = 1.0 / static_cast<double>(numBins - 1);
+
+        for (auto i = 0; i != numBins; ++i)
+        {
+            const auto proportion = static_cast<double>(i) * step;
+
+            const auto low = range.convertFrom0to1(juce::jmax(0.0, proportion - 0.5 * step)) / binWidth;
+            const auto high = range.convertFrom0to1(juce::jmin(1.0, proportion + 0.5 * step)) / binWidth;
+
+            auto first = juce::jlimit(0, lastBin, static_cast<int>(std::ceil(low)));
+            auto last = juce::jlimit(0, lastBin, static_cast<int>(std::floor(high)));
+
+            // narrower than an fft bin, use the nearest
+            if (last < first)
+                first = last = juce::jlimit(0, lastBin, juce::roundToInt(range.convertFrom0to1(proportion) / binWidth));
+
+            // summing the spectra over the display bin smooths the estimate
+            auto xx = 0.0, yy = 0.0, re = 0.0, im = 0.0;
+
+            for (auto bin = first; bin <= last; ++bin)
+            {
+                xx += sxx[static_cast<size_t>(bin)];
+                yy += syy[static_cast<size_t>(bin)];
+                re += sxyReal[static_cast<size_t>(bin)];
+                im += sxyImag[static_cast<size_t>(bin)];
+            }
+
+            const auto crossMagnitude = std::sqrt(re * re + im * im);
+            const auto hasSignal = xx > 1.0e-12;
+
+            if (magnitudes != nullptr)
+                magnitudes[i] = hasSignal ? static_cast<float>(crossMagnitude / xx) : 0.0f;
+
+            if (phases != nullptr)
+                phases[i] = hasSignal ? static_cast<float>(std::atan2(im, re)) : 0.0f;
+
+            if (coherence != nullptr)
+                coherence[i] = hasSignal && yy > 1.0e-12 ? static_cast<float>(crossMagnitude * crossMagnitude / (xx * yy)) : 0.0f;
+        }
+    }
+
+}   // namespace dsp
+}   // namespace gedd
@@ -0,0 +1,141 @@
+/*
+  ==============================================================================
+
+    TransferFunctionAnalyser.h
+    Created: 19 Oct 2026 8:44:37pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+namespace gedd
+{
+namespace dsp
+{
+    /*
+        Measures the transfer function of whatever runs between captureInput()
+        and captureOutput(), from the program material itself.
+
+        The audio thread only copies the mono input and output into two rings
+        that share one wait-free fifo, so every pair stays sample aligned. The
+        analysis thread averages the auto and cross spectra and reports the H1
+        estimate H = Sxy / Sxx, with the coherence |Sxy|^2 / (Sxx Syy) to tell
+        which bins had enough signal to be trusted.
+    */
+    class TransferFunctionAnalyser
+    {
+    public:
+        static constexpr int fftOrder{ 12 };
+        static constexpr int fftSize{ 1 << fftOrder };
+        static constexpr int hopSize{ fftSize / 2 };
+
+        TransferFunctionAnalyser();
+
+        // while inactive the audio thread copies nothing, any thread
+        void setActive(bool shouldBeActive) noexcept;
+
+        bool isActive() const noexcept { return active.load(std::memory_order_relaxed); }
+
+        // exponential averaging time of the spectra, any thread
+        void setAveragingTime(float seconds) noexcept;
+
+        float getAveragingTime() const noexcept { return averagingTime.load(); }
+
+        double getSampleRate() const noexcept { return sampleRate.load(); }
+
+        // Dsp methods
+        void prepare(const juce::dsp::ProcessSpec& spec) noexcept;
+
+        // audio thread, before processing
+        template<typename BlockType>
+        void captureInput(const BlockType& block) noexcept
+        {
+            pendingSize = 0;
+
+            if (!active.load(std::memory_order_relaxed) || block.getNumChannels() == 0)
+                return;
+
+            fifo.prepareToWrite(static_cast<int>(block.getNumSamples()), start1, size1, start2, size2);
+
+            writeMono(block, inputRing);
+            pendingSize = size1 + size2;
+        }
+
+        // audio thread, after processing the same samples, publishes the pair
+        template<typename BlockType>
+        void captureOutput(const BlockType& block) noexcept
+        {
+            if (pendingSize == 0)
+                return;
+
+            jassert(static_cast<int>(block.getNumSamples()) >= pendingSize);
+
+            writeMono(block, outputRing);
+            fifo.finishedWrite(pendingSize);
+
+            pendingSize = 0;
+        }
+
+        // analysis thread, consumes whole hops, returns false if there was no new frame
+        bool analyse();
+
+        /*
+            Analysis thread, numBins points evenly spaced in range's 0..1. Magnitude is linear gain,
+            phase in radians. Any output may be nullptr.
+        */
+        void getResponse(const juce::NormalisableRange<double>& range, float* magnitudes, float* phases, float* coherence, int numBins) const;
+
+    private:
+        template<typename BlockType>
+        void writeMono(const BlockType& block, std::vector<float>& ring) noexcept
+        {
+            const auto numChannels = block.getNumChannels();
+            const auto scale = 1.0f / static_cast<float>(numChannels);
+
+            auto write = [&](int destStart, int num, int sourceStart)
+            {
+                for (auto i = 0; i != num; ++i)
+                {
+                    auto sum = 0.0f;
+
+                    for (size_t channel = 0; channel != numChannels; ++channel)
+                        sum += static_cast<float>(block.getSample(static_cast<int>(channel), sourceStart + i));
+
+                    ring[static_cast<size_t>(destStart + i)] = sum * scale;
+                }
+            };
+
+            write(start1, size1, 0);
+            write(start2, size2, size1);
+        }
+
+        void processFrame();
+
+        static constexpr int fifoSize{ 4 * fftSize };
+        static constexpr int maxBacklog{ 4 * hopSize };
+
+        std::atomic<bool> active{ false }, resetRequested{ true };
+        std::atomic<double> sampleRate{ 44100.0 };
+        std::atomic<float> averagingTime{ 1.0f };
+
+        // audio -> analysis, both rings use the one fifo
+        juce::AbstractFifo fifo{ fifoSize };
+        std::vector<float> inputRing, outputRing;
+
+        // audio thread only, the write position between captureInput() and captureOutput()
+        int start1{ 0 }, size1{ 0 }, start2{ 0 }, size2{ 0 }, pendingSize{ 0 };
+
+        // analysis thread only
+        juce::dsp::FFT fft{ fftOrder };
+        juce::dsp::WindowingFunction<float> window{ static_cast<size_t>(fftSize), juce::dsp::WindowingFunction<float>::hann, false };
+        std::vector<float> inputHistory, outputHistory, inputData, outputData;
+        std::vector<float> sxx, syy, sxyReal, sxyImag;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TransferFunctionAnalyser)
+    };
+
+}   // namespace dsp
+}   // namespace gedd
@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    TripleBuffer.h
+    Created: 19 Oct 2026 5:12:31pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+namespace gedd
+{
+    /*
+        Lock-free single writer / single reader triple buffer.
+
+        The writer fills getWriteBuffer() and calls publish(), the reader calls
+        acquire() and then reads getReadBuffer(). Neither side ever waits and
+        neither ever sees a half written value. Anything published between two
+        acquire() calls is coalesced, the reader only gets the latest.
+
+        All three slots are constructed up front, so T may own allocations that
+        are reused from one publish to the next.
+    */
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        TripleBuffer() = default;
+
+        // writer
+        T& getWriteBuffer() noexcept { return buffers[static_cast<size_t>(writeIndex)]; }
+
+        void publish() noexcept
+        {
+            writeIndex = middle.exchange(writeIndex | freshBit, std::memory_order_acq_rel) & indexMask;
+        }
+
+        // reader, returns true if a newer value was published since the last call
+        bool acquire() noexcept
+        {
+            if ((middle.load(std::memory_order_relaxed) & freshBit) == 0)
+                return false;
+
+            readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & indexMask;
+            return true;
+        }
+
+        const T& getReadBuffer() const noexcept { return buffers[static_cast<size_t>(readIndex)]; }
+
+        // true if acquire() would return something new, either side
+        bool hasNewValue() const noexcept { return (middle.load(std::memory_order_relaxed) & freshBit) != 0; }
+
+    private:
+        static constexpr int indexMask{ 3 };
+        static constexpr int freshBit{ 4 };
+
+        std::array<T, 3> buffers;
+
+        int readIndex{ 0 };         // reader only
+        int writeIndex{ 1 };        // writer only
+        std::atomic<int> middle{ 2 };
+
+        JUCE_DECLARE_NON_COPYABLE(TripleBuffer)
+    };
+
+}   // namespace gedd
@@ -14,6 +14,187 @@ namespace gedd {
 namespace dsp {
 namespace VASVF {
 
+//====================================================
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeLowpass(double sampleRate, NumericType frequency, NumericType q) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = static_cast<NumericType>(1); // not used
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / q;
+
+    return { a, g, k, 0, 0, 1 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeBandpass(double sampleRate, NumericType frequency, NumericType q) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = static_cast<NumericType>(1); // not used
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / q;
+
+    return { a, g, k, 0, 1 * k, 0 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeHighpass(double sampleRate, NumericType frequency, NumericType q) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = static_cast<NumericType>(1); // not used
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / q;
+
+    return { a, g, k, 1, -k, -1 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeNotch(double sampleRate, NumericType frequency, NumericType q) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = static_cast<NumericType>(1); // not used
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / q;
+
+    return { a, g, k, 1, -k, 0 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeAllpass(double sampleRate, NumericType frequency, NumericType q) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = static_cast<NumericType>(1); // not used
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / q;
+
+    return { a, g, k, 1, -2 * k, 0 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeMorph(double sampleRate, NumericType frequency, NumericType q, NumericType morph) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = static_cast<NumericType>(1); // not used
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / q;
+
+    auto m0 = static_cast<NumericType>(0), m1 = static_cast<NumericType>(0), m2 = static_cast<NumericType>(0);
+    getMorphMix(morph, k, m0, m1, m2);
+
+    return { a, g, k, m0, m1, m2 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeBell(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = std::pow(static_cast<NumericType>(10), gain * static_cast<NumericType>(0.025));
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    const auto k = static_cast<NumericType>(1) / (State<NumericType>::calculateAutoQ(q, gain, autoQ) * a);
+
+    return { a, g, k, 1, k * (a * a - 1), 0 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeLowshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = std::pow(static_cast<NumericType>(10), gain * static_cast<NumericType>(0.025));
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi) / std::sqrt(a));
+    const auto k = static_cast<NumericType>(1) / State<NumericType>::calculateAutoQ(q, gain, autoQ);
+
+    return { a, g, k, 1, k * (a - 1), a * a - 1 };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::makeHighshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ) noexcept
+{
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    const auto a = std::pow(static_cast<NumericType>(10), gain * static_cast<NumericType>(0.025));
+    const auto g = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi) * std::sqrt(a));
+    const auto k = static_cast<NumericType>(1) / State<NumericType>::calculateAutoQ(q, gain, autoQ);
+
+    return { a, g, k, a * a, k * (1 - a) * a, 1 - a * a };
+}
+
+template<typename NumericType>
+typename ArrayState<NumericType>::Array ArrayState<NumericType>::make(FilterType type, double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ,
+                                                                     NumericType morph) noexcept
+{
+    const auto aq = State<NumericType>::calculateAutoQ(q, gain, autoQ);
+
+    switch (type)
+    {
+    case FilterType::lowpass:   return makeLowpass(sampleRate, frequency, aq);
+    case FilterType::bandpass:  return makeBandpass(sampleRate, frequency, aq);
+    case FilterType::highpass:  return makeHighpass(sampleRate, frequency, aq);
+    case FilterType::notch:     return makeNotch(sampleRate, frequency, aq);
+    case FilterType::allpass:   return makeAllpass(sampleRate, frequency, aq);
+    case FilterType::bell:      return makeBell(sampleRate, frequency, gain, q, autoQ);
+    case FilterType::lowshelf:  return makeLowshelf(sampleRate, frequency, gain, q, autoQ);
+    case FilterType::highshelf: return makeHighshelf(sampleRate, frequency, gain, q, autoQ);
+    case FilterType::morph:     return makeMorph(sampleRate, frequency, aq, morph);
+    default:                    break;
+    }
+
+    return makeNone();
+}
+
+template<typename NumericType>
+void ArrayState<NumericType>::getMorphMix(NumericType morph, NumericType k, NumericType& m0, NumericType& m1, NumericType& m2) noexcept
+{
+    // { m0, m1 / k, m2 } for lowpass, bandpass, highpass, notch, allpass
+    static constexpr NumericType mix[maxMorph + 1][3] = {
+        { 0,  0,  1 },
+        { 0,  1,  0 },
+        { 1, -1, -1 },
+        { 1, -1,  0 },
+        { 1, -2,  0 }
+    };
+
+    const auto pos = juce::jlimit(static_cast<NumericType>(0), static_cast<NumericType>(maxMorph), morph);
+    const auto index = juce::jmin(static_cast<int>(pos), maxMorph - 1);
+    const auto frac = pos - static_cast<NumericType>(index);
+
+    const auto* lo = mix[index];
+    const auto* hi = mix[index + 1];
+
+    m0 = lo[0] + frac * (hi[0] - lo[0]);
+    m1 = k * (lo[1] + frac * (hi[1] - lo[1]));
+    m2 = lo[2] + frac * (hi[2] - lo[2]);
+}
+
+//========================================================================
+template struct ArrayState<float>;
+template struct ArrayState<double>;
+
 //====================================================
 template<typename NumericType>
 State<NumericType>::State()
@@ -48,17 +229,16 @@ State<NumericType>::State(NumericType a, NumericType g, NumericType k,
 }
 
 template<typename NumericType>
-typename State<NumericType>::Ptr State<NumericType>::makeLowpass(double sampleRate, NumericType frequency, NumericType q)
+State<NumericType>::State(const typename ArrayState<NumericType>::Array& arr)
+    : State(arr[static_cast<size_t>(0)], arr[static_cast<size_t>(1)], arr[static_cast<size_t>(2)],
+            arr[static_cast<size_t>(3)], arr[static_cast<size_t>(4)], arr[static_cast<size_t>(5)])
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = static_cast<NumericType>(1); // not used
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi);
-    const auto k = static_cast<NumericType>(1) / q;
+}
 
-    return *new State(a, g, k, 0, 0, 1);
+template<typename NumericType>
+typename State<NumericType>::Ptr State<NumericType>::makeLowpass(double sampleRate, NumericType frequency, NumericType q)
+{
+    return *new State(ArrayState<NumericType>::makeLowpass(sampleRate, frequency, q));
 }
 
 template<typename NumericType>
@@ -70,15 +250,7 @@ typename State<NumericType>::Ptr State<NumericType>::makeLowpass(double sampleRa
 template<typename NumericType>
 typename State<NumericType>::Ptr State<NumericType>::makeBandpass(double sampleRate, NumericType frequency, NumericType q)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = static_cast<NumericType>(1); // not used
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi);
-    const auto k = static_cast<NumericType>(1) / q;
-
-    return *new State(a, g, k, 0, 1 * k, 0);
+    return *new State(ArrayState<NumericType>::makeBandpass(sampleRate, frequency, q));
 }
 
 template<typename NumericType>
@@ -90,15 +262,7 @@ typename State<NumericType>::Ptr State<NumericType>::makeBandpass(double sampleR
 template<typename NumericType>
 typename State<NumericType>::Ptr State<NumericType>::makeHighpass(double sampleRate, NumericType frequency, NumericType q)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = static_cast<NumericType>(1); // not used
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi);
-    const auto k = static_cast<NumericType>(1) / q;
-
-    return *new State(a, g, k, 1, -k, -1);
+    return *new State(ArrayState<NumericType>::makeHighpass(sampleRate, frequency, q));
 }
 
 template<typename NumericType>
@@ -110,15 +274,7 @@ typename State<NumericType>::Ptr State<NumericType>::makeHighpass(double sampleR
 template<typename NumericType>
 typename State<NumericType>::Ptr State<NumericType>::makeNotch(double sampleRate, NumericType frequency, NumericType q)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = static_cast<NumericType>(1); // not used
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi);
-    const auto k = static_cast<NumericType>(1) / q;
-
-    return *new State(a, g, k, 1, -k, 0);
+    return *new State(ArrayState<NumericType>::makeNotch(sampleRate, frequency, q));
 }
 
 template<typename NumericType>
@@ -130,15 +286,7 @@ typename State<NumericType>::Ptr State<NumericType>::makeNotch(double sampleRate
 template<typename NumericType>
 typename State<NumericType>::Ptr State<NumericType>::makeAllpass(double sampleRate, NumericType frequency, NumericType q)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = static_cast<NumericType>(1); // not used
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi);
-    const auto k = static_cast<NumericType>(1) / q;
-
-    return *new State(a, g, k, 1, -2 * k, 0);
+    return *new State(ArrayState<NumericType>::makeAllpass(sampleRate, frequency, q));
 }
 
 template<typename NumericType>
@@ -148,45 +296,33 @@ typename State<NumericType>::Ptr State<NumericType>::makeAllpass(double sampleRa
 }
 
 template<typename NumericType>
-typename State<NumericType>::Ptr State<NumericType>::makeBell(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ)
+typename State<NumericType>::Ptr State<NumericType>::makeMorph(double sampleRate, NumericType frequency, NumericType q, NumericType morph)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
+    return *new State(ArrayState<NumericType>::makeMorph(sampleRate, frequency, q, morph));
+}
 
-    const auto a = std::pow(static_cast<NumericType>(10), gain * static_cast<NumericType>(0.025));
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi);
-    const auto k = static_cast<NumericType>(1) / (calculateAutoQ(q, gain, autoQ) * a);
+template<typename NumericType>
+typename State<NumericType>::Ptr State<NumericType>::makeMorph(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ, NumericType morph)
+{
+    return makeMorph(sampleRate, frequency, calculateAutoQ(q, gain, autoQ), morph);
+}
 
-    return *new State(a, g, k, 1, k * (a * a - 1), 0);
+template<typename NumericType>
+typename State<NumericType>::Ptr State<NumericType>::makeBell(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ)
+{
+    return *new State(ArrayState<NumericType>::makeBell(sampleRate, frequency, gain, q, autoQ));
 }
 
 template<typename NumericType>
 typename State<NumericType>::Ptr State<NumericType>::makeLowshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = std::pow(static_cast<NumericType>(10), gain * static_cast<NumericType>(0.025));
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi) / std::sqrt(a);
-    const auto k = static_cast<NumericType>(1) / calculateAutoQ(q, gain, autoQ);
-
-    return *new State(a, g, k, 1, k * (a - 1), a * a - 1);
+    return *new State(ArrayState<NumericType>::makeLowshelf(sampleRate, frequency, gain, q, autoQ));
 }
 
 template<typename NumericType>
 typename State<NumericType>::Ptr State<NumericType>::makeHighshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ)
 {
-    jassert(sampleRate > 0.0);
-    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
-    jassert(q > static_cast<NumericType>(0));
-
-    const auto a = std::pow(static_cast<NumericType>(10), gain * static_cast<NumericType>(0.025));
-    const auto g = std::tan(frequency / sampleRate * juce::MathConstants<double>::pi) * std::sqrt(a);
-    const auto k = static_cast<NumericType>(1) / calculateAutoQ(q, gain, autoQ);
-
-    return *new State(a, g, k, a * a, k * (1 - a) * a, 1 - a * a);
+    return *new State(ArrayState<NumericType>::makeHighshelf(sampleRate, frequency, gain, q, autoQ));
 }
 
 template<typename NumericType>
@@ -216,8 +352,7 @@ double State<NumericType>::getMagnitudeForFrequency(double frequency, double sam
 template<typename NumericType>
 void State<NumericType>::getMagnitudeForFrequencyArray(const double* frequencies, double* magnitudes, size_t numSamples, double sampleRate) const noexcept
 {
-    for (auto sample = 0; sample != numSamples; ++sample)
-        magnitudes[sample] = getMagnitudeForFrequency(frequencies[sample], sampleRate);
+    getResponseForFrequencyArray(frequencies, magnitudes, nullptr, numSamples, sampleRate);
 }
 
 template<typename NumericType>
@@ -247,8 +382,284 @@ double State<NumericType>::getPhaseForFrequency(double frequency, double sampleR
 template<typename NumericType>
 void State<NumericType>::getPhaseForFrequencyArray(const double* frequencies, double* phases, size_t numSamples, double sampleRate) const noexcept
 {
-    for (auto sample = 0; sample != numSamples; ++sample)
-        phases[sample] = getPhaseForFrequency(frequencies[sample], sampleRate);
+    getResponseForFrequencyArray(frequencies, nullptr, phases, numSamples, sampleRate);
+}
+
+namespace {
+
+// H(z) = m0 + (n2 z^2 + n1 z + n0) / (d2 z^2 + d1 z + d0), z = e^-jw
+struct ResponseCoefficients
+{
+    template<typename NumericType>
+    explicit ResponseCoefficients(const std::array<NumericType, 9>& data) noexcept
+    {
+        const auto g  = static_cast<double>(data[static_cast<size_t>(1)]);
+        const auto k  = static_cast<double>(data[static_cast<size_t>(2)]);
+        const auto m1 = static_cast<double>(data[static_cast<size_t>(4)]);
+        const auto m2 = static_cast<double>(data[static_cast<size_t>(5)]);
+
+        const auto gsq = g * g;
+
+        m0 = static_cast<double>(data[static_cast<size_t>(3)]);
+        n2 = gsq * m2 - g * m1;
+        n1 = 2.0 * gsq * m2;
+        n0 = gsq * m2 + g * m1;
+        d2 = gsq - g * k + 1.0;
+        d1 = 2.0 * gsq - 2.0;
+        d0 = gsq + g * k + 1.0;
+    }
+
+    // numerator of the whole response, m0 D + N
+    double b0() const noexcept { return m0 * d0 + n0; }
+    double b1() const noexcept { return m0 * d1 + n1; }
+    double b2() const noexcept { return m0 * d2 + n2; }
+
+    double m0, n0, n1, n2, d0, d1, d2;
+};
+
+}   // namespace
+
+// Re(P'(z) / P(z)) for P = p0 + p1 z + p2 z^2, z = e^-jw, which is the group delay of P in samples
+static inline double polynomialGroupDelay(double p0, double p1, double p2, double zr, double zi, double z2r, double z2i) noexcept
+{
+    const auto pr = p0 + p1 * zr + p2 * z2r;
+    const auto pi = p1 * zi + p2 * z2i;
+    const auto dr = p1 * zr + 2.0 * p2 * z2r;
+    const auto di = p1 * zi + 2.0 * p2 * z2i;
+
+    const auto magSq = pr * pr + pi * pi;
+
+    // a zero on the unit circle, the phase jumps and the delay is undefined
+    if (magSq < 1.0e-24)
+        return 0.0;
+
+    return (dr * pr + di * pi) / magSq;
+}
+
+// roots of c2 x^2 + c1 x + c0, returns how many
+static inline int solveQuadratic(double c2, double c1, double c0, std::array<juce::dsp::Complex<double>, 2>& roots) noexcept
+{
+    using Complex = juce::dsp::Complex<double>;
+
+    const auto scale = std::abs(c2) + std::abs(c1) + std::abs(c0);
+
+    if (scale == 0.0)
+        return 0;
+
+    if (std::abs(c2) < 1.0e-12 * scale)
+    {
+        if (std::abs(c1) < 1.0e-12 * scale)
+            return 0;
+
+        roots[0] = Complex(-c0 / c1, 0.0);
+        return 1;
+    }
+
+    const auto root = std::sqrt(Complex(c1 * c1 - 4.0 * c2 * c0, 0.0));
+
+    // avoids cancellation between -c1 and the root
+    const auto q = -0.5 * (c1 >= 0.0 ? Complex(c1, 0.0) + root : Complex(c1, 0.0) - root);
+
+    roots[0] = q / c2;
+    roots[1] = std::abs(q) > 0.0 ? Complex(c0, 0.0) / q : Complex(0.0, 0.0);
+
+    return 2;
+}
+
+template<typename NumericType>
+void State<NumericType>::getResponseForFrequencyArray(const double* frequencies, double* magnitudes, double* phases, size_t numSamples, double sampleRate) const noexcept
+{
+    const ResponseCoefficients c(data);
+    const auto w = -2.0 * juce::MathConstants<double>::pi / sampleRate;
+
+    for (size_t i = 0; i != numSamples; ++i)
+    {
+        const auto zr = std::cos(w * frequencies[i]);
+        const auto zi = std::sin(w * frequencies[i]);
+        const auto z2r = zr * zr - zi * zi;
+        const auto z2i = 2.0 * zr * zi;
+
+        const auto nr = c.n2 * z2r + c.n1 * zr + c.n0;
+        const auto ni = c.n2 * z2i + c.n1 * zi;
+        const auto dr = c.d2 * z2r + c.d1 * zr + c.d0;
+        const auto di = c.d2 * z2i + c.d1 * zi;
+
+        const auto invDen = 1.0 / (dr * dr + di * di);
+        const auto re = c.m0 + (nr * dr + ni * di) * invDen;
+        const auto im = (ni * dr - nr * di) * invDen;
+
+        if (magnitudes != nullptr)
+            magnitudes[i] = std::sqrt(re * re + im * im);
+
+        if (phases != nullptr)
+            phases[i] = std::atan2(im, re);
+    }
+}
+
+template<typename NumericType>
+void State<NumericType>::getResponseForFrequencyArray(const ResponseTable& table, double* magnitudes, double* phases) const noexcept
+{
+    using SIMDType = ResponseTable::SIMDType;
+    constexpr auto lanes = ResponseTable::lanes;
+
+    const ResponseCoefficients c(data);
+
+    const auto n0 = SIMDType::expand(c.n0);
+    const auto n1 = SIMDType::expand(c.n1);
+    const auto n2 = SIMDType::expand(c.n2);
+    const auto d0 = SIMDType::expand(c.d0);
+    const auto d1 = SIMDType::expand(c.d1);
+    const auto d2 = SIMDType::expand(c.d2);
+
+    const auto* zRe  = table.getArray(ResponseTable::zReArray);
+    const auto* zIm  = table.getArray(ResponseTable::zImArray);
+    const auto* z2Re = table.getArray(ResponseTable::z2ReArray);
+    const auto* z2Im = table.getArray(ResponseTable::z2ImArray);
+
+    alignas(SIMDType::SIMDRegisterSize) double re[lanes] = {};
+    alignas(SIMDType::SIMDRegisterSize) double im[lanes] = {};
+    alignas(SIMDType::SIMDRegisterSize) double den[lanes] = {};
+
+    const auto numFrequencies = table.getNumFrequencies();
+
+    for (size_t first = 0; first < numFrequencies; first += lanes)
+    {
+        const auto zr  = SIMDType::fromRawArray(zRe + first);
+        const auto zi  = SIMDType::fromRawArray(zIm + first);
+        const auto z2r = SIMDType::fromRawArray(z2Re + first);
+        const auto z2i = SIMDType::fromRawArray(z2Im + first);
+
+        const auto nr = n2 * z2r + n1 * zr + n0;
+        const auto ni = n2 * z2i + n1 * zi;
+        const auto dr = d2 * z2r + d1 * zr + d0;
+        const auto di = d2 * z2i + d1 * zi;
+
+        // N conj(D) and |D|^2, SIMDRegister has no divide so that is done per lane
+        (nr * dr + ni * di).copyToRawArray(re);
+        (ni * dr - nr * di).copyToRawArray(im);
+        (dr * dr + di * di).copyToRawArray(den);
+
+        const auto last = juce::jmin(lanes, numFrequencies - first);
+
+        for (size_t lane = 0; lane != last; ++lane)
+        {
+            const auto invDen = 1.0 / den[lane];
+            const auto r = c.m0 + re[lane] * invDen;
+            const auto i = im[lane] * invDen;
+
+            if (magnitudes != nullptr)
+                magnitudes[first + lane] = std::sqrt(r * r + i * i);
+
+            if (phases != nullptr)
+                phases[first + lane] = std::atan2(i, r);
+        }
+    }
+}
+
+template<typename NumericType>
+double State<NumericType>::getGroupDelayForFrequency(double frequency, double sampleRate) const noexcept
+{
+    auto delay = 0.0;
+    getGroupDelayForFrequencyArray(&frequency, &delay, 1, sampleRate);
+
+    return delay;
+}
+
+template<typename NumericType>
+void State<NumericType>::getGroupDelayForFrequencyArray(const double* frequencies, double* delays, size_t numSamples, double sampleRate) const noexcept
+{
+    const ResponseCoefficients c(data);
+    const auto w = -2.0 * juce::MathConstants<double>::pi / sampleRate;
+
+    for (size_t i = 0; i != numSamples; ++i)
+    {
+        const auto zr = std::cos(w * frequencies[i]);
+        const auto zi = std::sin(w * frequencies[i]);
+        const auto z2r = zr * zr - zi * zi;
+        const auto z2i = 2.0 * zr * zi;
+
+        delays[i] = polynomialGroupDelay(c.b0(), c.b1(), c.b2(), zr, zi, z2r, z2i)
+                  - polynomialGroupDelay(c.d0, c.d1, c.d2, zr, zi, z2r, z2i);
+    }
+}
+
+template<typename NumericType>
+void State<NumericType>::getGroupDelayForFrequencyArray(const ResponseTable& table, double* delays) const noexcept
+{
+    using SIMDType = ResponseTable::SIMDType;
+    constexpr auto lanes = ResponseTable::lanes;
+
+    const ResponseCoefficients c(data);
+
+    const auto b0 = SIMDType::expand(c.b0());
+    const auto b1 = SIMDType::expand(c.b1());
+    const auto b2 = SIMDType::expand(c.b2());
+    const auto twoB2 = SIMDType::expand(2.0 * c.b2());
+    const auto d0 = SIMDType::expand(c.d0);
+    const auto d1 = SIMDType::expand(c.d1);
+    const auto d2 = SIMDType::expand(c.d2);
+    const auto twoD2 = SIMDType::expand(2.0 * c.d2);
+
+    const auto* zRe  = table.getArray(ResponseTable::zReArray);
+    const auto* zIm  = table.getArray(ResponseTable::zImArray);
+    const auto* z2Re = table.getArray(ResponseTable::z2ReArray);
+    const auto* z2Im = table.getArray(ResponseTable::z2ImArray);
+
+    alignas(SIMDType::SIMDRegisterSize) double bNum[lanes] = {};
+    alignas(SIMDType::SIMDRegisterSize) double bDen[lanes] = {};
+    alignas(SIMDType::SIMDRegisterSize) double aNum[lanes] = {};
+    alignas(SIMDType::SIMDRegisterSize) double aDen[lanes] = {};
+
+    const auto numFrequencies = table.getNumFrequencies();
+
+    for (size_t first = 0; first < numFrequencies; first += lanes)
+    {
+        const auto zr  = SIMDType::fromRawArray(zRe + first);
+        const auto zi  = SIMDType::fromRawArray(zIm + first);
+        const auto z2r = SIMDType::fromRawArray(z2Re + first);
+        const auto z2i = SIMDType::fromRawArray(z2Im + first);
+
+        // P and z P'(z) for both polynomials, see polynomialGroupDelay()
+        const auto br = b0 + b1 * zr + b2 * z2r;
+        const auto bi = b1 * zi + b2 * z2i;
+        const auto bdr = b1 * zr + twoB2 * z2r;
+        const auto bdi = b1 * zi + twoB2 * z2i;
+
+        const auto ar = d0 + d1 * zr + d2 * z2r;
+        const auto ai = d1 * zi + d2 * z2i;
+        const auto adr = d1 * zr + twoD2 * z2r;
+        const auto adi = d1 * zi + twoD2 * z2i;
+
+        (bdr * br + bdi * bi).copyToRawArray(bNum);
+        (br * br + bi * bi).copyToRawArray(bDen);
+        (adr * ar + adi * ai).copyToRawArray(aNum);
+        (ar * ar + ai * ai).copyToRawArray(aDen);
+
+        const auto last = juce::jmin(lanes, numFrequencies - first);
+
+        for (size_t lane = 0; lane != last; ++lane)
+        {
+            // same guards as the scalar path, a root on the unit circle contributes nothing
+            const auto numeratorDelay = bDen[lane] < 1.0e-24 ? 0.0 : bNum[lane] / bDen[lane];
+            const auto denominatorDelay = aDen[lane] < 1.0e-24 ? 0.0 : aNum[lane] / aDen[lane];
+
+            delays[first + lane] = numeratorDelay - denominatorDelay;
+        }
+    }
+}
+
+template<typename NumericType>
+PolesAndZeros State<NumericType>::getPolesAndZeros() const noexcept
+{
+    const ResponseCoefficients c(data);
+
+    // H is a polynomial in z^-1, multiplying through by z^2 gives p0 z^2 + p1 z + p2
+    PolesAndZeros pz;
+    pz.numPoles = solveQuadratic(c.d0, c.d1, c.d2, pz.poles);
+    pz.numZeros = solveQuadratic(c.b0(), c.b1(), c.b2(), pz.zeros);
+    pz.gain = c.d0 != 0.0 ? c.b0() / c.d0 : 0.0;
+
+    return pz;
 }
 
 template<typename NumericType>
@@ -264,6 +675,104 @@ NumericType State<NumericType>::calculateAutoQ(NumericType q, NumericType gain,
 template struct State<float>;
 template struct State<double>;
 
+//========================================================================
+void ResponseTable::setFrequencies(const double* frequencies, size_t numFrequenciesToUse, double sampleRate)
+{
+    jassert(sampleRate > 0.0);
+
+    numFrequencies = numFrequenciesToUse;
+    paddedNumFrequencies = ((numFrequencies + lanes - 1) / lanes) * lanes;
+    tableSampleRate = sampleRate;
+
+    dataBlock.allocate(static_cast<size_t>(numArrays) * paddedNumFrequencies * sizeof(double) + SIMDType::SIMDRegisterSize, true);
+    alignedData = juce::snapPointerToAlignment(reinterpret_cast<double*>(dataBlock.get()), SIMDType::SIMDRegisterSize);
+
+    auto* zRe  = alignedData + static_cast<size_t>(zReArray) * paddedNumFrequencies;
+    auto* zIm  = alignedData + static_cast<size_t>(zImArray) * paddedNumFrequencies;
+    auto* z2Re = alignedData + static_cast<size_t>(z2ReArray) * paddedNumFrequencies;
+    auto* z2Im = alignedData + static_cast<size_t>(z2ImArray) * paddedNumFrequencies;
+
+    const auto w = -2.0 * juce::MathConstants<double>::pi / sampleRate;
+
+    for (size_t i = 0; i != numFrequencies; ++i)
+    {
+        zRe[i]  = std::cos(w * frequencies[i]);
+        zIm[i]  = std::sin(w * frequencies[i]);
+        z2Re[i] = std::cos(2.0 * w * frequencies[i]);
+        z2Im[i] = std::sin(2.0 * w * frequencies[i]);
+    }
+}
+
+//========================================================================
+template<typename NumericType>
+void GainDesigner<NumericType>::prepare(FilterType newType, double sampleRate, NumericType frequency, NumericType q) noexcept
+{
+    jassert(supportsType(newType));
+    jassert(sampleRate > 0.0);
+    jassert(juce::isPositiveAndNotGreaterThan(frequency, sampleRate * 0.5));
+    jassert(q > static_cast<NumericType>(0));
+
+    type = newType;
+    tanw = static_cast<NumericType>(std::tan(frequency / sampleRate * juce::MathConstants<double>::pi));
+    invQ = static_cast<NumericType>(1) / q;
+}
+
+template<typename NumericType>
+void GainDesigner<NumericType>::apply(State<NumericType>& s, NumericType gain) const noexcept
+{
+    // sqrt(a) = 10^(gain / 80), so a single exp covers both the bell and shelf designs
+    const auto sqrta = std::exp(gain * static_cast<NumericType>(0.028782313662425574));
+    const auto a = sqrta * sqrta;
+
+    NumericType g, k, m0, m1, m2;
+
+    switch (type)
+    {
+    case FilterType::lowshelf:
+        g = tanw / sqrta;
+        k = invQ;
+        m0 = 1;
+        m1 = k * (a - 1);
+        m2 = a * a - 1;
+        break;
+
+    case FilterType::highshelf:
+        g = tanw * sqrta;
+        k = invQ;
+        m0 = a * a;
+        m1 = k * (1 - a) * a;
+        m2 = 1 - a * a;
+        break;
+
+    case FilterType::bell:
+    default:
+        g = tanw;
+        k = invQ / a;
+        m0 = 1;
+        m1 = k * (a * a - 1);
+        m2 = 0;
+        break;
+    }
+
+    const auto a1 = static_cast<NumericType>(1) / (static_cast<NumericType>(1) + g * (g + k));
+    const auto a2 = g * a1;
+    const auto a3 = g * a2;
+
+    auto& d = s.data;
+    d[static_cast<size_t>(0)] = a;
+    d[static_cast<size_t>(1)] = g;
+    d[static_cast<size_t>(2)] = k;
+    d[static_cast<size_t>(3)] = m0;
+    d[static_cast<size_t>(4)] = m1;
+    d[static_cast<size_t>(5)] = m2;
+    d[static_cast<size_t>(6)] = a1;
+    d[static_cast<size_t>(7)] = a2;
+    d[static_cast<size_t>(8)] = a3;
+}
+
+template struct GainDesigner<float>;
+template struct GainDesigner<double>;
+
 //========================================================================
 template<typename SampleType>
 Filter<SampleType>::Filter()
@@ -323,6 +832,100 @@ SampleType JUCE_VECTOR_CALLTYPE Filter<SampleType>::processSample(SampleType v0)
     return s[static_cast<size_t>(3)] * v0 + s[static_cast<size_t>(4)] * v1 + s[static_cast<size_t>(5)] * v2;
 }
 
+template<typename SampleType>
+void Filter<SampleType>::processMixed(const SampleType* src, SampleType* dst, size_t numSamples,
+                                      const NumericType* m0, const NumericType* m1, const NumericType* m2) noexcept
+{
+    jassert(coeffs != nullptr);
+
+    const auto& s = coeffs->data;
+
+    const auto a1 = s[static_cast<size_t>(6)];
+    const auto a2 = s[static_cast<size_t>(7)];
+    const auto a3 = s[static_cast<size_t>(8)];
+
+    auto ic1 = iceq[static_cast<size_t>(0)];
+    auto ic2 = iceq[static_cast<size_t>(1)];
+
+    for (size_t sample = 0; sample != numSamples; ++sample)
+    {
+        const auto v0 = src[sample];
+        const auto v3 = v0 - ic2;
+        const auto v1 = a1 * ic1 + a2 * v3;
+        const auto v2 = ic2 + a2 * ic1 + a3 * v3;
+
+        ic1 = static_cast<SampleType>(2) * v1 - ic1;
+        ic2 = static_cast<SampleType>(2) * v2 - ic2;
+
+        dst[sample] = m0[sample] * v0 + m1[sample] * v1 + m2[sample] * v2;
+    }
+
+    iceq[static_cast<size_t>(0)] = ic1;
+    iceq[static_cast<size_t>(1)] = ic2;
+
+#if JUCE_SNAP_TO_ZERO
+    snapToZero();
+#endif
+}
+
+template<typename SampleType>
+void Filter<SampleType>::processModulated(const SampleType* src, SampleType* dst, size_t numSamples,
+                                          const NumericType* a1, const NumericType* a2, const NumericType* a3,
+                                          const NumericType* m1, NumericType m0, NumericType m2) noexcept
+{
+    auto ic1 = iceq[static_cast<size_t>(0)];
+    auto ic2 = iceq[static_cast<size_t>(1)];
+
+    for (size_t sample = 0; sample != numSamples; ++sample)
+    {
+        const auto v0 = src[sample];
+        const auto v3 = v0 - ic2;
+        const auto v1 = a1[sample] * ic1 + a2[sample] * v3;
+        const auto v2 = ic2 + a2[sample] * ic1 + a3[sample] * v3;
+
+        ic1 = static_cast<SampleType>(2) * v1 - ic1;
+        ic2 = static_cast<SampleType>(2) * v2 - ic2;
+
+        dst[sample] = m0 * v0 + m1[sample] * v1 + m2 * v2;
+    }
+
+    iceq[static_cast<size_t>(0)] = ic1;
+    iceq[static_cast<size_t>(1)] = ic2;
+
+#if JUCE_SNAP_TO_ZERO
+    snapToZero();
+#endif
+}
+
+template<typename SampleType>
+void Filter<SampleType>::processModulated(const SampleType* src, SampleType* dst, size_t numSamples,
+                                          const NumericType* a1, const NumericType* a2, const NumericType* a3,
+                                          const NumericType* m0, const NumericType* m1, const NumericType* m2) noexcept
+{
+    auto ic1 = iceq[static_cast<size_t>(0)];
+    auto ic2 = iceq[static_cast<size_t>(1)];
+
+    for (size_t sample = 0; sample != numSamples; ++sample)
+    {
+        const auto v0 = src[sample];
+        const auto v3 = v0 - ic2;
+        const auto v1 = a1[sample] * ic1 + a2[sample] * v3;
+        const auto v2 = ic2 + a2[sample] * ic1 + a3[sample] * v3;
+
+        ic1 = static_cast<SampleType>(2) * v1 - ic1;
+        ic2 = static_cast<SampleType>(2) * v2 - ic2;
+
+        dst[sample] = m0[sample] * v0 + m1[sample] * v1 + m2[sample] * v2;
+    }
+
+    iceq[static_cast<size_t>(0)] = ic1;
+    iceq[static_cast<size_t>(1)] = ic2;
+
+#if JUCE_SNAP_TO_ZERO
+    snapToZero();
+#endif
+}
+
 template class Filter<float>;
 template class Filter<double>;
 
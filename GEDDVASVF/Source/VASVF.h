@@ -28,6 +28,7 @@ namespace VASVF {
         bell,
         lowshelf,
         highshelf,
+        morph,
         numTypes
     };
 
@@ -41,12 +42,51 @@ namespace VASVF {
         "allpass",
         "bell",
         "lowshelf",
-        "highshelf"
+        "highshelf",
+        "morph"
     };
 
     template<typename NumericType>
     struct State;
 
+    // Allocation free coefficient design, returns { a, g, k, m0, m1, m2 }
+    template<typename NumericType>
+    struct ArrayState
+    {
+        using Array = std::array<NumericType, 6>;
+
+        static Array makeLowpass(double sampleRate, NumericType frequency, NumericType q) noexcept;
+
+        static Array makeBandpass(double sampleRate, NumericType frequency, NumericType q) noexcept;
+
+        static Array makeHighpass(double sampleRate, NumericType frequency, NumericType q) noexcept;
+
+        static Array makeNotch(double sampleRate, NumericType frequency, NumericType q) noexcept;
+
+        static Array makeAllpass(double sampleRate, NumericType frequency, NumericType q) noexcept;
+
+        static Array makeBell(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ) noexcept;
+
+        static Array makeLowshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ) noexcept;
+
+        static Array makeHighshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ) noexcept;
+
+        // continuous lowpass (0) > bandpass (1) > highpass (2) > notch (3) > allpass (4)
+        static Array makeMorph(double sampleRate, NumericType frequency, NumericType q, NumericType morph) noexcept;
+
+        // passthrough for FilterType::none
+        static Array makeNone() noexcept { return { 1, 1, 1, 1, 0, 0 }; }
+
+        // dispatch on type, auto q is applied to every type like VASVFProcessor does
+        static Array make(FilterType type, double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ,
+                          NumericType morph = 0) noexcept;
+
+        // mix for a morph position, g and k are the same for every morph type so only the mix changes
+        static void getMorphMix(NumericType morph, NumericType k, NumericType& m0, NumericType& m1, NumericType& m2) noexcept;
+
+        static constexpr int maxMorph{ 4 };
+    };
+
     template <typename SampleType>
     class Filter
     {
@@ -79,6 +119,20 @@ namespace VASVF {
 
         SampleType JUCE_VECTOR_CALLTYPE processSample(SampleType v0) noexcept;
 
+        // per sample mix with the current coeffs, e.g. audio rate morphing
+        void processMixed(const SampleType* src, SampleType* dst, size_t numSamples,
+                          const NumericType* m0, const NumericType* m1, const NumericType* m2) noexcept;
+
+        // per sample coefficients, e.g. audio rate modulation. m0 and m2 are constant for every type
+        void processModulated(const SampleType* src, SampleType* dst, size_t numSamples,
+                              const NumericType* a1, const NumericType* a2, const NumericType* a3,
+                              const NumericType* m1, NumericType m0, NumericType m2) noexcept;
+
+        // as above with every mix coefficient per sample too, e.g. morphing between presets
+        void processModulated(const SampleType* src, SampleType* dst, size_t numSamples,
+                              const NumericType* a1, const NumericType* a2, const NumericType* a3,
+                              const NumericType* m0, const NumericType* m1, const NumericType* m2) noexcept;
+
         template<typename ProcessContext>
         void process(const ProcessContext& context) noexcept
         {
@@ -121,6 +175,81 @@ namespace VASVF {
         JUCE_LEAK_DETECTOR(Filter)
     };
 
+    /*
+        Fast incremental design for bell and shelf types where only the gain changes,
+        e.g. dynamic eq. tan() and 1/q are computed once in prepare(), each call to
+        apply() then costs a single exp and writes straight into an existing State.
+        Auto q is not supported as it would make k depend on gain.
+    */
+    template<typename NumericType>
+    struct GainDesigner
+    {
+        void prepare(FilterType newType, double sampleRate, NumericType frequency, NumericType q) noexcept;
+
+        void apply(State<NumericType>& s, NumericType gain) const noexcept;
+
+        static bool supportsType(FilterType t) noexcept
+        {
+            return t == FilterType::bell || t == FilterType::lowshelf || t == FilterType::highshelf;
+        }
+
+        FilterType type{ FilterType::bell };
+        NumericType tanw{ 1 };      // prewarped frequency
+        NumericType invQ{ 1 };
+    };
+
+    /*
+        Cached z = e^-jw and z^2 for a fixed frequency vector and sample rate, so that
+        evaluating a response only costs the two quadratics in z.
+        Stored SoA and padded to whole SIMD registers.
+    */
+    class ResponseTable
+    {
+    public:
+        using SIMDType = juce::dsp::SIMDRegister<double>;
+
+        static constexpr size_t lanes = SIMDType::SIMDNumElements;
+
+        ResponseTable() = default;
+
+        // allocates, rebuild whenever the frequencies or sample rate change
+        void setFrequencies(const double* frequencies, size_t numFrequenciesToUse, double sampleRate);
+
+        size_t getNumFrequencies() const noexcept { return numFrequencies; }
+
+        size_t getPaddedNumFrequencies() const noexcept { return paddedNumFrequencies; }
+
+        double getSampleRate() const noexcept { return tableSampleRate; }
+
+        enum Array
+        {
+            zReArray = 0,
+            zImArray,
+            z2ReArray,
+            z2ImArray,
+            numArrays
+        };
+
+        const double* getArray(Array index) const noexcept { return alignedData + static_cast<size_t>(index) * paddedNumFrequencies; }
+
+    private:
+        size_t numFrequencies{ 0 }, paddedNumFrequencies{ 0 };
+        double tableSampleRate{ 0.0 };
+
+        juce::HeapBlock<char> dataBlock;
+        double* alignedData{ nullptr };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResponseTable)
+    };
+
+    // closed form roots of the digital transfer function, in the z plane
+    struct PolesAndZeros
+    {
+        std::array<juce::dsp::Complex<double>, 2> poles, zeros;
+        int numPoles{ 0 }, numZeros{ 0 };
+        double gain{ 1.0 };     // leading coefficient ratio, H(z) = gain * prod(z - zero) / prod(z - pole)
+    };
+
     template<typename NumericType>
     struct State : public juce::dsp::ProcessorState
     {
@@ -131,6 +260,9 @@ namespace VASVF {
         State(NumericType a, NumericType g, NumericType k, 
               NumericType m0, NumericType m1, NumericType m2);
 
+        // create with coeffs from ArrayState
+        explicit State(const typename ArrayState<NumericType>::Array& arr);
+
         State(const State&) = default;
         State(State&&) = default;
         State& operator=(const State&) = default;
@@ -158,6 +290,10 @@ namespace VASVF {
 
         static Ptr makeAllpass(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ);
 
+        static Ptr makeMorph(double sampleRate, NumericType frequency, NumericType q, NumericType morph);
+
+        static Ptr makeMorph(double sampleRate, NumericType frequency, NumericType gain, NumericType q, bool autoQ, NumericType morph);
+
         static Ptr makeBell(double sampleRate, NumericType frequency, NumericType gain, NumericType q = inverseRootTwo, bool autoQ = false);
 
         static Ptr makeLowshelf(double sampleRate, NumericType frequency, NumericType gain, NumericType q = inverseRootTwo, bool autoQ = false);
@@ -172,11 +308,53 @@ namespace VASVF {
 
         void getPhaseForFrequencyArray(const double* frequencies, double* phases, size_t numSamples, double sampleRate) const noexcept;
 
+        // magnitude and phase in one pass, either output may be nullptr
+        void getResponseForFrequencyArray(const double* frequencies, double* magnitudes, double* phases, size_t numSamples, double sampleRate) const noexcept;
+
+        // as above from a cached table, SIMD across frequencies. Outputs hold table.getNumFrequencies()
+        void getResponseForFrequencyArray(const ResponseTable& table, double* magnitudes, double* phases) const noexcept;
+
+        // analytic group delay in samples, -d(phase)/dw
+        double getGroupDelayForFrequency(double frequency, double sampleRate) const noexcept;
+
+        void getGroupDelayForFrequencyArray(const double* frequencies, double* delays, size_t numSamples, double sampleRate) const noexcept;
+
+        void getGroupDelayForFrequencyArray(const ResponseTable& table, double* delays) const noexcept;
+
+        PolesAndZeros getPolesAndZeros() const noexcept;
+
         static NumericType calculateAutoQ(NumericType q, NumericType gain, bool aq) noexcept;
 
         std::array<NumericType, 9> data;    // a, g, k, m0, m1, m2, a1, a2, a3
     };
 
+    // plain copy of a State's data for handing across threads, see VASVFProcessor::getStateSnapshot()
+    struct StateSnapshot
+    {
+        std::array<double, 9> data{};       // as State::data
+        double sampleRate{ 0.0 };
+    };
+
+    /*
+        Coefficients for a set of bands, designed off the audio thread and published
+        through gedd::RcuSlots, see VASVFProcessor::setDesignSource().
+    */
+    template <typename SampleType, int maxBands = 1>
+    struct StateSet
+    {
+        void setBand(int band, const State<SampleType>& s) noexcept
+        {
+            jassert(juce::isPositiveAndBelow(band, maxBands));
+
+            data[static_cast<size_t>(band)] = s.data;
+            numBands = juce::jmax(numBands, band + 1);
+        }
+
+        std::array<std::array<SampleType, 9>, static_cast<size_t>(maxBands)> data{};     // as State::data
+        int numBands{ 0 };
+        double sampleRate{ 0.0 };
+    };
+
 }   // namespace VASVF
 }   // namespace dsp
 }   // namespace gedd
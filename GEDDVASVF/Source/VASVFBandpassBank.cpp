@@ -0,0 +1,320 @@
+/*
+  ==============================================================================
+
+    VASVFBandpassBank.cpp
+    Created: 19 Oct 2026 11:40:21am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "VASVFBandpassBank.h"
+
+namespace gedd {
+namespace dsp {
+namespace VASVF {
+
+template <typename SampleType>
+void BandpassBank<SampleType>::setBands(const SampleType* centreFrequencies, int numBandsToUse, SampleType q)
+{
+    jassert(numBandsToUse > 0);
+    jassert(q > static_cast<SampleType>(0));
+
+    frequencies.assign(centreFrequencies, centreFrequencies + numBandsToUse);
+    numBands = numBandsToUse;
+    bandQ = q;
+
+    allocate();
+
+    if (sampleRate > 0.0)
+        updateCoefficients();
+
+    reset();
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::setFractionalOctaveBands(int bandsPerOctave, SampleType minFrequency, SampleType maxFrequency)
+{
+    jassert(bandsPerOctave > 0);
+    jassert(minFrequency > static_cast<SampleType>(0) && minFrequency < maxFrequency);
+
+    const auto bpo = static_cast<double>(bandsPerOctave);
+    const auto ratio = std::pow(2.0, 1.0 / bpo);
+
+    std::vector<SampleType> centres;
+
+    // first band at or above minFrequency on the 1kHz referenced grid
+    for (auto n = static_cast<int>(std::ceil(bpo * std::log2(static_cast<double>(minFrequency) / 1000.0))); ; ++n)
+    {
+        const auto f = 1000.0 * std::pow(2.0, static_cast<double>(n) / bpo);
+
+        if (f > static_cast<double>(maxFrequency))
+            break;
+
+        centres.push_back(static_cast<SampleType>(f));
+    }
+
+    if (centres.empty())
+        return;
+
+    // q for a -3dB bandwidth of 1/bandsPerOctave octave
+    setBands(centres.data(), static_cast<int>(centres.size()), static_cast<SampleType>(std::sqrt(ratio) / (ratio - 1.0)));
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::setDecimation(int numSamplesPerMeasurement) noexcept
+{
+    jassert(numSamplesPerMeasurement > 0);
+
+    decimation = numSamplesPerMeasurement;
+    samplesUntilPublish = decimation;
+
+    if (alignedData != nullptr)
+    {
+        std::fill(getArray(sumSquaresArray), getArray(sumSquaresArray) + paddedNumBands, static_cast<SampleType>(0));
+        std::fill(getArray(peakArray), getArray(peakArray) + paddedNumBands, static_cast<SampleType>(0));
+    }
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.sampleRate > 0);
+
+    sampleRate = spec.sampleRate;
+
+    if (numBands > 0)
+        updateCoefficients();
+
+    reset();
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::reset() noexcept
+{
+    if (alignedData == nullptr)
+        return;
+
+    // clears integrators and accumulators
+    std::fill(getArray(ic1Array), getArray(ic1Array) + paddedNumBands * static_cast<size_t>(numArrays - ic1Array), static_cast<SampleType>(0));
+
+    for (auto band = 0; band != numBands; ++band)
+    {
+        rms[static_cast<size_t>(band)].store(static_cast<SampleType>(0), std::memory_order_relaxed);
+        peak[static_cast<size_t>(band)].store(static_cast<SampleType>(0), std::memory_order_relaxed);
+    }
+
+    samplesUntilPublish = decimation;
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::process(const SampleType* input, int numSamples) noexcept
+{
+    processInternal<false>(input, nullptr, numSamples);
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::process(const SampleType* input, SampleType* const* bandOutputs, int numSamples) noexcept
+{
+    jassert(bandOutputs != nullptr);
+
+    processInternal<true>(input, bandOutputs, numSamples);
+}
+
+template <typename SampleType>
+SampleType BandpassBank<SampleType>::getBandFrequency(int band) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(band, numBands));
+
+    return frequencies[static_cast<size_t>(band)];
+}
+
+template <typename SampleType>
+SampleType BandpassBank<SampleType>::getRms(int band) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(band, numBands));
+
+    return rms[static_cast<size_t>(band)].load(std::memory_order_relaxed);
+}
+
+template <typename SampleType>
+SampleType BandpassBank<SampleType>::getPeak(int band) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(band, numBands));
+
+    return peak[static_cast<size_t>(band)].load(std::memory_order_relaxed);
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::allocate()
+{
+    // round up to a whole number of SIMD registers so every group is aligned
+    paddedNumBands = ((static_cast<size_t>(numBands) + lanes - 1) / lanes) * lanes;
+
+    dataBlock.allocate(static_cast<size_t>(numArrays) * paddedNumBands * sizeof(SampleType) + SIMDType::SIMDRegisterSize, true);
+    alignedData = juce::snapPointerToAlignment(reinterpret_cast<SampleType*>(dataBlock.get()), SIMDType::SIMDRegisterSize);
+
+    rms.reset(new std::atomic<SampleType>[static_cast<size_t>(numBands)]);
+    peak.reset(new std::atomic<SampleType>[static_cast<size_t>(numBands)]);
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::updateCoefficients()
+{
+    jassert(sampleRate > 0);
+
+    auto* a1s = getArray(a1Array);
+    auto* a2s = getArray(a2Array);
+    auto* a3s = getArray(a3Array);
+    auto* m1s = getArray(m1Array);
+
+    const auto nyquistLimit = static_cast<SampleType>(sampleRate * 0.49);
+
+    // padding lanes keep zeroed coefficients and so output silence
+    for (auto band = 0; band != numBands; ++band)
+    {
+        const auto f = juce::jmin(frequencies[static_cast<size_t>(band)], nyquistLimit);
+        const auto s = State<SampleType>::makeBandpass(sampleRate, f, bandQ);
+
+        a1s[band] = s->data[static_cast<size_t>(6)];
+        a2s[band] = s->data[static_cast<size_t>(7)];
+        a3s[band] = s->data[static_cast<size_t>(8)];
+        m1s[band] = s->data[static_cast<size_t>(4)];
+    }
+}
+
+template <typename SampleType>
+template <bool writeOutputs>
+void BandpassBank<SampleType>::processInternal(const SampleType* input, SampleType* const* bandOutputs, int numSamples) noexcept
+{
+    jassert(sampleRate > 0);
+
+    if (numBands == 0)
+        return;
+
+    auto position = 0;
+
+    while (position < numSamples)
+    {
+        const auto num = juce::jmin(numSamples - position, samplesUntilPublish);
+
+        processGroups<writeOutputs>(input, bandOutputs, position, num);
+
+        position += num;
+        samplesUntilPublish -= num;
+
+        if (samplesUntilPublish == 0)
+        {
+            publish();
+            samplesUntilPublish = decimation;
+        }
+    }
+
+#if JUCE_SNAP_TO_ZERO
+    auto* ic1s = getArray(ic1Array);
+    auto* ic2s = getArray(ic2Array);
+
+    for (auto band = 0; band != numBands; ++band)
+    {
+        juce::dsp::util::snapToZero(ic1s[band]);
+        juce::dsp::util::snapToZero(ic2s[band]);
+    }
+#endif
+}
+
+template <typename SampleType>
+template <bool writeOutputs>
+void BandpassBank<SampleType>::processGroups(const SampleType* input, SampleType* const* bandOutputs, int startSample, int numSamples) noexcept
+{
+    const auto* a1s = getArray(a1Array);
+    const auto* a2s = getArray(a2Array);
+    const auto* a3s = getArray(a3Array);
+    const auto* m1s = getArray(m1Array);
+
+    auto* ic1s = getArray(ic1Array);
+    auto* ic2s = getArray(ic2Array);
+    auto* sumSquares = getArray(sumSquaresArray);
+    auto* peaks = getArray(peakArray);
+
+    const auto zero = SIMDType::expand(static_cast<SampleType>(0));
+    const auto two = SIMDType::expand(static_cast<SampleType>(2));
+
+    alignas(SIMDType::SIMDRegisterSize) SampleType out[lanes] = {};
+
+    const auto* src = input + startSample;
+    const auto numGroups = paddedNumBands / lanes;
+
+    for (size_t group = 0; group != numGroups; ++group)
+    {
+        const auto first = group * lanes;
+        const auto last = juce::jmin(first + lanes, static_cast<size_t>(numBands));
+
+        const auto a1 = SIMDType::fromRawArray(a1s + first);
+        const auto a2 = SIMDType::fromRawArray(a2s + first);
+        const auto a3 = SIMDType::fromRawArray(a3s + first);
+        const auto m1 = SIMDType::fromRawArray(m1s + first);
+
+        auto ic1 = SIMDType::fromRawArray(ic1s + first);
+        auto ic2 = SIMDType::fromRawArray(ic2s + first);
+        auto sumSq = SIMDType::fromRawArray(sumSquares + first);
+        auto pk = SIMDType::fromRawArray(peaks + first);
+
+        for (auto sample = 0; sample != numSamples; ++sample)
+        {
+            // same input in every lane
+            const auto v0 = SIMDType::expand(src[sample]);
+            const auto v3 = v0 - ic2;
+            const auto v1 = a1 * ic1 + a2 * v3;
+            const auto v2 = ic2 + a2 * ic1 + a3 * v3;
+
+            ic1 = two * v1 - ic1;
+            ic2 = two * v2 - ic2;
+
+            const auto y = m1 * v1;
+
+            sumSq += y * y;
+            pk = SIMDType::max(pk, SIMDType::max(y, zero - y));
+
+            if (writeOutputs)
+            {
+                y.copyToRawArray(out);
+
+                for (auto band = first; band != last; ++band)
+                    bandOutputs[band][startSample + sample] = out[band - first];
+            }
+        }
+
+        ic1.copyToRawArray(ic1s + first);
+        ic2.copyToRawArray(ic2s + first);
+        sumSq.copyToRawArray(sumSquares + first);
+        pk.copyToRawArray(peaks + first);
+    }
+}
+
+template <typename SampleType>
+void BandpassBank<SampleType>::publish() noexcept
+{
+    auto* sumSquares = getArray(sumSquaresArray);
+    auto* peaks = getArray(peakArray);
+
+    const auto scale = static_cast<SampleType>(1) / static_cast<SampleType>(decimation);
+
+    for (auto band = 0; band != numBands; ++band)
+    {
+        rms[static_cast<size_t>(band)].store(std::sqrt(sumSquares[band] * scale), std::memory_order_relaxed);
+        peak[static_cast<size_t>(band)].store(peaks[band], std::memory_order_relaxed);
+    }
+
+    std::fill(sumSquares, sumSquares + paddedNumBands, static_cast<SampleType>(0));
+    std::fill(peaks, peaks + paddedNumBands, static_cast<SampleType>(0));
+
+    numMeasurements.fetch_add(1, std::memory_order_release);
+}
+
+//=====================================
+template class BandpassBank<float>;
+template class BandpassBank<double>;
+
+}   // namespace VASVF
+}   // namespace dsp
+}   // namespace gedd
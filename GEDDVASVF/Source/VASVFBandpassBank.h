@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    VASVFBandpassBank.h
+    Created: 19 Oct 2026 11:40:21am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "VASVF.h"
+
+namespace gedd {
+namespace dsp {
+namespace VASVF {
+
+    /*
+        Bank of parallel bandpass VASVFs sharing one input stream, for fractional
+        octave analysis or vocoder style band splitting.
+
+        Bands are processed SIMDRegister::size() at a time, with per band rms
+        and peak accumulated over 'decimation' samples and then published to
+        atomics that can be read from any thread while the bands stay the same.
+
+        setBands() / setFractionalOctaveBands() allocate, so call them off the audio thread.
+    */
+    template <typename SampleType>
+    class BandpassBank
+    {
+    public:
+        using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+
+        static constexpr size_t lanes = SIMDType::SIMDNumElements;
+
+        BandpassBank() = default;
+
+        // setup - not realtime safe
+        void setBands(const SampleType* centreFrequencies, int numBandsToUse, SampleType q);
+
+        // 1/bandsPerOctave octave bands, base 2, centred on 1kHz
+        void setFractionalOctaveBands(int bandsPerOctave, SampleType minFrequency, SampleType maxFrequency);
+
+        void setDecimation(int numSamplesPerMeasurement) noexcept;
+
+        // Dsp methods
+        void prepare(const juce::dsp::ProcessSpec& spec);
+
+        void reset() noexcept;
+
+        // analysis only
+        void process(const SampleType* input, int numSamples) noexcept;
+
+        // analysis plus one output channel per band
+        void process(const SampleType* input, SampleType* const* bandOutputs, int numSamples) noexcept;
+
+        // getters
+        int getNumBands() const noexcept { return numBands; }
+
+        int getDecimation() const noexcept { return decimation; }
+
+        SampleType getBandFrequency(int band) const noexcept;
+
+        SampleType getBandQ() const noexcept { return bandQ; }
+
+        // latest published measurements - safe from any thread, but not concurrently
+        // with setBands() / setFractionalOctaveBands(), which reallocate them
+        SampleType getRms(int band) const noexcept;
+
+        SampleType getPeak(int band) const noexcept;
+
+        juce::uint32 getNumMeasurements() const noexcept { return numMeasurements.load(std::memory_order_acquire); }
+
+    private:
+        enum Array
+        {
+            a1Array = 0,
+            a2Array,
+            a3Array,
+            m1Array,
+            ic1Array,
+            ic2Array,
+            sumSquaresArray,
+            peakArray,
+            numArrays
+        };
+
+        SampleType* getArray(Array index) const noexcept { return alignedData + static_cast<size_t>(index) * paddedNumBands; }
+
+        void allocate();
+
+        void updateCoefficients();
+
+        template <bool writeOutputs>
+        void processInternal(const SampleType* input, SampleType* const* bandOutputs, int numSamples) noexcept;
+
+        template <bool writeOutputs>
+        void processGroups(const SampleType* input, SampleType* const* bandOutputs, int startSample, int numSamples) noexcept;
+
+        void publish() noexcept;
+
+        double sampleRate{ 0.0 };
+        int numBands{ 0 };
+        size_t paddedNumBands{ 0 };
+        SampleType bandQ{ static_cast<SampleType>(0.70710678118654752440L) };
+
+        int decimation{ 1024 };
+        int samplesUntilPublish{ 1024 };
+
+        std::vector<SampleType> frequencies;
+
+        // aligned SoA coefficient, state & accumulator storage
+        juce::HeapBlock<char> dataBlock;
+        SampleType* alignedData{ nullptr };
+
+        // published results
+        std::unique_ptr<std::atomic<SampleType>[]> rms;
+        std::unique_ptr<std::atomic<SampleType>[]> peak;
+        std::atomic<juce::uint32> numMeasurements{ 0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BandpassBank)
+    };
+
+}   // namespace VASVF
+}   // namespace dsp
+}   // namespace gedd
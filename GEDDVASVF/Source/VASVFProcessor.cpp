@@ -23,6 +23,10 @@ namespace dsp
             filterType = t;
 
             shouldUpdate = true;
+
+            // process() doesn't update() while the type is none
+            if (filterType == FilterType::none)
+                publishState();
         }
     }
 
@@ -72,6 +76,19 @@ namespace dsp
         }
     }
 
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setMorph(SampleType m) noexcept
+    {
+        jassert(juce::isPositiveAndNotGreaterThan(m, static_cast<SampleType>(VASVF::ArrayState<SampleType>::maxMorph)));
+
+        if (m != morph.getCurrentValue())
+        {
+            morph.setTargetValue(m);
+
+            shouldUpdate = true;
+        }
+    }
+
     template<typename SampleType>
     void VASVFProcessor<SampleType>::setRampDurationSeconds(double newRampDurationSeconds) noexcept
     {
@@ -79,7 +96,78 @@ namespace dsp
         {
             rampDurationSeconds = newRampDurationSeconds;
 
-            reset();
+            if (sampleRate == 0.0)
+                return;
+
+            // ramps in progress carry on from where they are over the new time, the filters keep their state
+            auto retime = [this](juce::LinearSmoothedValue<SampleType>& value)
+            {
+                const auto current = value.getCurrentValue();
+                const auto target = value.getTargetValue();
+
+                value.reset(sampleRate, rampDurationSeconds);
+                value.setCurrentAndTargetValue(current);
+                value.setTargetValue(target);
+            };
+
+            retime(frequency);
+            retime(gain);
+            retime(q);
+            retime(morph);
+        }
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setDynamicsEnabled(bool shouldBeEnabled) noexcept
+    {
+        if (shouldBeEnabled != dynamicsEnabled)
+        {
+            dynamicsEnabled = shouldBeEnabled;
+            dynamicGain = 0;
+
+            shouldUpdate = true;
+        }
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setSidechainEnabled(bool shouldBeEnabled) noexcept
+    {
+        sidechainEnabled = shouldBeEnabled;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setThreshold(SampleType thresholdDecibels) noexcept
+    {
+        threshold = thresholdDecibels;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setRatio(SampleType newRatio) noexcept
+    {
+        jassert(newRatio > 0);
+
+        ratio = newRatio;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setAttack(SampleType attackMs) noexcept
+    {
+        if (attackMs != attack)
+        {
+            attack = attackMs;
+
+            updateEnvelopeCoefficients();
+        }
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setRelease(SampleType releaseMs) noexcept
+    {
+        if (releaseMs != release)
+        {
+            release = releaseMs;
+
+            updateEnvelopeCoefficients();
         }
     }
 
@@ -88,73 +176,346 @@ namespace dsp
     {
         sampleRate = spec.sampleRate;
 
-        filterProcessor.prepare(spec);
+        filters.assign(spec.numChannels, VASVF::Filter<SampleType>(state));
+
+        for (auto& f : filters)
+            f.prepare(spec);
+
+        fillPitchTable();
+
+        modA1.resize(modulationBlockSize);
+        modA2.resize(modulationBlockSize);
+        modA3.resize(modulationBlockSize);
+        modM1.resize(modulationBlockSize);
+
+        morphM0.resize(modulationBlockSize);
+        morphM1.resize(modulationBlockSize);
+        morphM2.resize(modulationBlockSize);
+
+        updateEnvelopeCoefficients();
 
         reset();
+
+        // the state has to be redesigned for the new sample rate
+        shouldUpdate = true;
+        publishState();
     }
 
     template<typename SampleType>
     void VASVFProcessor<SampleType>::reset() noexcept
     {
-        filterProcessor.reset();
+        for (auto& f : filters)
+            f.reset();
+
+        // lands on the target
+        if (isPresetMorphing())
+        {
+            advancePresetMorph(presetMorphRemaining);
+            endPresetMorphBlock();
+        }
+
+        dynamicGain = 0;
 
         if (sampleRate != 0.0)
         {
             frequency.reset(sampleRate, rampDurationSeconds);
             gain.reset(sampleRate, rampDurationSeconds);
             q.reset(sampleRate, rampDurationSeconds);
+            morph.reset(sampleRate, rampDurationSeconds);
         }
     }
 
     template<typename SampleType>
     void VASVFProcessor<SampleType>::skip(int numSampleToSkip) noexcept
     {
+        if (isPresetMorphing())
+        {
+            advancePresetMorph(numSampleToSkip);
+            endPresetMorphBlock();
+        }
+
         frequency.skip(numSampleToSkip);
         gain.skip(numSampleToSkip);
         q.skip(numSampleToSkip);
+        morph.skip(numSampleToSkip);
     }
 
     template<typename SampleType>
-    void VASVFProcessor<SampleType>::update() noexcept
+    void VASVFProcessor<SampleType>::update(int numSamples) noexcept
     {
         jassert(sampleRate > 0);
+        jassert(numSamples > 0);
 
         if (!shouldUpdate) return;
 
-        const auto sf = frequency.getNextValue();
-        const auto sg = gain.getNextValue();
-        const auto sq = q.getNextValue();
+        // ramps run in time, the caller splits long blocks so they don't step
+        const auto sf = frequency.skip(numSamples);
+        const auto sg = gain.skip(numSamples);
+        const auto sq = q.skip(numSamples);
         
         jassert(sf > 0);
         jassert(sq > 0);
 
-        VASVF::State<SampleType>::Ptr newState;
-
-        switch (filterType)
+        if (isDynamic())
         {
-        case FilterType::lowpass:   newState = VASVF::State<SampleType>::makeLowpass(sampleRate, sf, sg, sq, autoQ);   break;
-        case FilterType::bandpass:  newState = VASVF::State<SampleType>::makeBandpass(sampleRate, sf, sg, sq, autoQ);  break;
-        case FilterType::highpass:  newState = VASVF::State<SampleType>::makeHighpass(sampleRate, sf, sg, sq, autoQ);  break;
-        case FilterType::notch:     newState = VASVF::State<SampleType>::makeNotch(sampleRate, sf, sg, sq, autoQ);     break;
-        case FilterType::allpass:   newState = VASVF::State<SampleType>::makeAllpass(sampleRate, sf, sg, sq, autoQ);   break;
-        case FilterType::bell:      newState = VASVF::State<SampleType>::makeBell(sampleRate, sf, sg, sq, autoQ);      break;
-        case FilterType::lowshelf:  newState = VASVF::State<SampleType>::makeLowshelf(sampleRate, sf, sg, sq, autoQ);  break;
-        case FilterType::highshelf: newState = VASVF::State<SampleType>::makeHighshelf(sampleRate, sf, sg, sq, autoQ); break;
+            // coefficients are written per control block in updateDynamicGain()
+            prepareGainDesigner(filterType, sf, sg, sq, autoQ);
         }
-
-        if (newState)
+        else
         {
-            *filterProcessor.state = *newState;
+            *state = VASVF::State<SampleType>(VASVF::ArrayState<SampleType>::make(filterType, sampleRate, sf, sg, sq, autoQ, morph.getCurrentValue()));
+
+            publishState();
         }
 
         if (!frequency.isSmoothing() &&
             !gain.isSmoothing() &&
-            !q.isSmoothing())
+            !q.isSmoothing() &&
+            !morph.isSmoothing())
         {
             shouldUpdate = false;
         }
     }
 
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::updateDynamicGain(SampleType level) noexcept
+    {
+        // gain computer, ratio > 1 cuts and ratio < 1 boosts above threshold
+        const auto over = juce::Decibels::gainToDecibels(level) - threshold;
+        const auto maxGain = static_cast<SampleType>(36);
+
+        auto target = static_cast<SampleType>(0);
+
+        if (over > 0)
+            target = juce::jlimit(-maxGain, maxGain, over * (static_cast<SampleType>(1) / ratio - static_cast<SampleType>(1)));
+
+        const auto coeff = std::abs(target) > std::abs(dynamicGain) ? attackCoeff : releaseCoeff;
+
+        dynamicGain = target + coeff * (dynamicGain - target);
+
+        gainDesigner.apply(*state, staticGain + dynamicGain);
+
+        publishState();
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::prepareGainDesigner(FilterType type, SampleType f, SampleType g, SampleType qValue, bool aq) noexcept
+    {
+        // the static design's q, so with no dynamic gain both curves are the same
+        gainDesigner.prepare(type, sampleRate, f, VASVF::State<SampleType>::calculateAutoQ(qValue, g, aq));
+        staticGain = g;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::publishState() noexcept
+    {
+        VASVF::StateSnapshot snapshot;
+        snapshot.sampleRate = sampleRate;
+
+        if (filterType == FilterType::none)
+        {
+            const VASVF::State<double> passthrough(VASVF::ArrayState<double>::makeNone());
+            snapshot.data = passthrough.data;
+        }
+        else
+        {
+            for (size_t i = 0; i != snapshot.data.size(); ++i)
+                snapshot.data[i] = static_cast<double>(state->data[i]);
+        }
+
+        stateSnapshot.store(snapshot);
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::setDesignSource(DesignSource* newSource) noexcept
+    {
+        designSource = newSource;
+
+        // back to our own design, from the current parameters
+        if (designSource == nullptr)
+            shouldUpdate = true;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::pickUpDesignedState() noexcept
+    {
+        // a copy, the slot stays the designer's
+        if (const auto* set = designSource->acquire())
+        {
+            jassert(set->numBands > 0);
+            jassert(set->sampleRate == sampleRate);
+
+            std::copy(set->data[0].begin(), set->data[0].end(), state->data.begin());
+            publishState();
+        }
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::morphTo(const MorphTarget& target, double seconds) noexcept
+    {
+        jassert(sampleRate > 0);
+        jassert(target.state.sampleRate == sampleRate);
+
+        // from whatever is running now, passthrough included
+        if (filterType == FilterType::none)
+            presetFrom = VASVF::State<SampleType>(VASVF::ArrayState<SampleType>::makeNone()).data;
+        else
+            presetFrom = state->data;
+
+        for (size_t i = 0; i != presetTo.size(); ++i)
+            presetTo[i] = static_cast<SampleType>(target.state.data[i]);
+
+        filterType = target.type;
+        autoQ = target.autoQ;
+        frequency.setCurrentAndTargetValue(target.frequency);
+        gain.setCurrentAndTargetValue(target.gain);
+        q.setCurrentAndTargetValue(target.q);
+        morph.setCurrentAndTargetValue(target.morph);
+
+        // the target's coefficients are already the design for these parameters
+        shouldUpdate = false;
+
+        // dynamic gain picks up from the target's design once the morph ends, not the previous one
+        if (VASVF::GainDesigner<SampleType>::supportsType(target.type))
+            prepareGainDesigner(target.type, target.frequency, target.gain, target.q, target.autoQ);
+
+        presetMorphRemaining = juce::jmax(1, juce::roundToInt(seconds * sampleRate));
+        presetMorphStep = static_cast<SampleType>(1) / static_cast<SampleType>(presetMorphRemaining);
+        presetMorphPosition = 0;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::fillPresetMorphCoefficients(size_t numSamples) noexcept
+    {
+        const auto one = static_cast<SampleType>(1);
+
+        for (size_t i = 0; i != numSamples; ++i)
+        {
+            advancePresetMorph(1);
+
+            const auto t = presetMorphPosition;
+            auto lerp = [t, this](size_t index) { return presetFrom[index] + t * (presetTo[index] - presetFrom[index]); };
+
+            const auto g = lerp(1);
+            const auto k = lerp(2);
+
+            modA1[i] = one / (one + g * (g + k));
+            modA2[i] = g * modA1[i];
+            modA3[i] = g * modA2[i];
+
+            morphM0[i] = lerp(3);
+            morphM1[i] = lerp(4);
+            morphM2[i] = lerp(5);
+        }
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::advancePresetMorph(int numSamples) noexcept
+    {
+        presetMorphRemaining = juce::jmax(0, presetMorphRemaining - numSamples);
+        presetMorphPosition = presetMorphRemaining == 0 ? static_cast<SampleType>(1)
+                                                        : presetMorphPosition + static_cast<SampleType>(numSamples) * presetMorphStep;
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::endPresetMorphBlock() noexcept
+    {
+        // where the morph has got to, for the trace and the next block
+        auto& s = state->data;
+        const auto t = presetMorphPosition;
+
+        for (size_t i = 0; i != 6; ++i)
+            s[i] = presetFrom[i] + t * (presetTo[i] - presetFrom[i]);
+
+        if (presetMorphRemaining == 0)
+            s = presetTo;
+        else
+            s = VASVF::State<SampleType>(s[0], s[1], s[2], s[3], s[4], s[5]).data;
+
+        publishState();
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::updateEnvelopeCoefficients() noexcept
+    {
+        if (sampleRate == 0.0) return;
+
+        // one pole coefficients at the control rate
+        const auto controlRate = sampleRate / static_cast<double>(controlInterval);
+
+        attackCoeff  = static_cast<SampleType>(std::exp(-1000.0 / (juce::jmax(static_cast<double>(attack), 0.01) * controlRate)));
+        releaseCoeff = static_cast<SampleType>(std::exp(-1000.0 / (juce::jmax(static_cast<double>(release), 0.01) * controlRate)));
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::fillPitchTable()
+    {
+        // ~5Hz up to just below nyquist, where tan() is still well behaved
+        pitchTableStart = static_cast<SampleType>(std::log2(5.0));
+        pitchTableEnd = static_cast<SampleType>(std::log2(sampleRate * 0.49));
+
+        const auto numPoints = static_cast<size_t>(std::ceil((pitchTableEnd - pitchTableStart) * pitchTableResolution)) + 2;
+
+        pitchTable.resize(numPoints);
+
+        for (size_t i = 0; i != numPoints; ++i)
+        {
+            const auto f = std::exp2(static_cast<double>(pitchTableStart) + static_cast<double>(i) / pitchTableResolution);
+            pitchTable[i] = static_cast<SampleType>(std::tan(juce::MathConstants<double>::pi * juce::jmin(f, sampleRate * 0.49) / sampleRate));
+        }
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::updateModulationBase() noexcept
+    {
+        const auto f = frequency.getCurrentValue();
+        const auto base = VASVF::ArrayState<SampleType>::make(filterType, sampleRate, f, gain.getCurrentValue(), q.getCurrentValue(), autoQ, morph.getCurrentValue());
+
+        const auto g = base[static_cast<size_t>(1)];
+        const auto k = base[static_cast<size_t>(2)];
+
+        // shelves scale the prewarped frequency by sqrt(a), keep that ratio
+        modGScale = g / static_cast<SampleType>(std::tan(juce::MathConstants<double>::pi * static_cast<double>(f) / sampleRate));
+        modLog2Frequency = std::log2(f);
+        modQ = q.getCurrentValue();
+        modK = k;
+        modM1PerK = base[static_cast<size_t>(4)] / k;
+        modM0 = base[static_cast<size_t>(3)];
+        modM2 = base[static_cast<size_t>(5)];
+    }
+
+    template<typename SampleType>
+    void VASVFProcessor<SampleType>::fillModulatedCoefficients(const SampleType* cutoffOctaves, const SampleType* qOffset, size_t numSamples) noexcept
+    {
+        jassert(numSamples <= modA1.size());
+
+        const auto one = static_cast<SampleType>(1);
+        const auto minQ = static_cast<SampleType>(0.025);
+        const auto lastIndex = static_cast<SampleType>(pitchTable.size() - 2);
+        const auto kq = modK * modQ;
+
+        for (size_t i = 0; i != numSamples; ++i)
+        {
+            // linear interpolation in the prewarped table, clamped to ~5Hz..0.49fs
+            const auto pitch = cutoffOctaves != nullptr ? modLog2Frequency + cutoffOctaves[i] : modLog2Frequency;
+            const auto pos = juce::jlimit(static_cast<SampleType>(0), lastIndex, (pitch - pitchTableStart) * static_cast<SampleType>(pitchTableResolution));
+            const auto index = static_cast<size_t>(pos);
+            const auto frac = pos - static_cast<SampleType>(index);
+
+            const auto g = modGScale * (pitchTable[index] + frac * (pitchTable[index + 1] - pitchTable[index]));
+
+            // k scales with 1/q, so the type specific part of k and m1 is kept
+            const auto k = qOffset != nullptr ? kq / juce::jmax(minQ, modQ + qOffset[i]) : modK;
+
+            const auto a1 = one / (one + g * (g + k));
+
+            modA1[i] = a1;
+            modA2[i] = g * a1;
+            modA3[i] = g * g * a1;
+            modM1[i] = k * modM1PerK;
+        }
+    }
+
 //=====================================
 template class VASVFProcessor<float>;
 template class VASVFProcessor<double>;
@@ -12,6 +12,8 @@
 #include <JuceHeader.h>
 #include "VASVF.h"
 #include "CommonFunctions.h"
+#include "SeqLock.h"
+#include "RcuSlots.h"
 
 namespace gedd
 {
@@ -23,6 +25,7 @@ namespace dsp
     {
     public:
         using FilterType = VASVF::FilterType;
+        using DesignSource = RcuSlots<VASVF::StateSet<SampleType>>;
 
         VASVFProcessor() noexcept {};
 
@@ -37,8 +40,25 @@ namespace dsp
 
         void setAutoQ(bool aq) noexcept;
 
+        // FilterType::morph position, 0 lowpass .. 4 allpass
+        void setMorph(SampleType m) noexcept;
+
+        // audio thread, ramps in progress are re-timed, the filters are not reset
         void setRampDurationSeconds(double newRampDurationSeconds) noexcept;
 
+        // dynamic eq - only applies to bell and shelf types
+        void setDynamicsEnabled(bool shouldBeEnabled) noexcept;
+
+        void setSidechainEnabled(bool shouldBeEnabled) noexcept;
+
+        void setThreshold(SampleType thresholdDecibels) noexcept;
+
+        void setRatio(SampleType newRatio) noexcept;
+
+        void setAttack(SampleType attackMs) noexcept;
+
+        void setRelease(SampleType releaseMs) noexcept;
+
         // getters
         FilterType getType() const { return filterType; }
 
@@ -50,10 +70,64 @@ namespace dsp
 
         bool getAutoQ() const { return autoQ; }
 
+        SampleType getMorph() const { return morph.getCurrentValue(); }
+
         double getRampDurationSeconds() const { return rampDurationSeconds; }
 
         double getSampleRate() const { return sampleRate; }
 
+        bool getDynamicsEnabled() const { return dynamicsEnabled; }
+
+        bool getSidechainEnabled() const { return sidechainEnabled; }
+
+        SampleType getThreshold() const { return threshold; }
+
+        SampleType getRatio() const { return ratio; }
+
+        SampleType getAttack() const { return attack; }
+
+        SampleType getRelease() const { return release; }
+
+        // current dynamic gain offset in dB
+        SampleType getDynamicGain() const { return dynamicGain; }
+
+        bool isDynamic() const noexcept { return dynamicsEnabled && VASVF::GainDesigner<SampleType>::supportsType(filterType); }
+
+        bool isMorphing() const noexcept { return filterType == FilterType::morph && morph.isSmoothing(); }
+
+        /*
+            Not while processing. While set, band 0 of the latest set published by a design thread replaces
+            this processor's own design at the start of each block, so the audio thread runs no tan or pow.
+            Ramps and dynamic gain are then up to the designer. Audio rate modulation still designs here.
+            nullptr goes back to designing from the parameters.
+        */
+        void setDesignSource(DesignSource* newSource) noexcept;
+
+        DesignSource* getDesignSource() const noexcept { return designSource; }
+
+        // a stored preset, designed when it was stored
+        struct MorphTarget
+        {
+            FilterType type{ FilterType::none };
+            SampleType frequency{ 1000 }, gain{ 0 }, q{ 1 }, morph{ 0 };
+            bool autoQ{ false };
+
+            VASVF::StateSnapshot state;
+        };
+
+        /*
+            Audio thread. Interpolates from the coefficients in use to the target's in coefficient space,
+            per sample over the given time, so nothing is designed while morphing. g and k stay positive
+            so every step is stable. The parameters jump to the target's without ramping, parameter
+            changes made during the morph are ramped to once it ends. Dynamic gain is not applied while morphing.
+        */
+        void morphTo(const MorphTarget& target, double seconds) noexcept;
+
+        bool isPresetMorphing() const noexcept { return presetMorphRemaining > 0; }
+
+        // coefficients and sample rate in use, published by the audio thread whenever they change. Any thread
+        const SeqLock<VASVF::StateSnapshot>& getStateSnapshot() const noexcept { return stateSnapshot; }
+
         // Dsp methods
         void prepare(const juce::dsp::ProcessSpec& spec) noexcept;
 
@@ -61,7 +135,8 @@ namespace dsp
 
         void skip(int numSampleToSkip) noexcept;
 
-        void update() noexcept;
+        // advances the smoothed parameters by numSamples
+        void update(int numSamples = 1) noexcept;
 
         template<typename ProcessContext = juce::dsp::ProcessContextReplacing<float>>
         void process(const ProcessContext& context) noexcept
@@ -84,24 +159,308 @@ namespace dsp
                 return;
             }
 
-            update();
+            if (isPresetMorphing())
+            {
+                processPresetMorph(context);
+                return;
+            }
+
+            if (designSource != nullptr)
+            {
+                pickUpDesignedState();
+
+                if (isMorphing())
+                    processMorphing(context);
+                else
+                    processFilters(context);
+
+                return;
+            }
+
+            update(static_cast<int>(numSamples));
+
+            if (isDynamic())
+                processDynamic(context, inputBlock);
+            else if (isMorphing())
+                processMorphing(context);
+            else
+                processFilters(context);
+        }
 
-            filterProcessor.process(context);
+        /*
+            As above, with a sidechain for the dynamic eq detector.
+            The main input is used while the sidechain is disabled or has no channels.
+        */
+        template<typename ProcessContext = juce::dsp::ProcessContextReplacing<float>>
+        void process(const ProcessContext& context, const juce::dsp::AudioBlock<SampleType>& sidechainBlock) noexcept
+        {
+            if (!isDynamic() || !sidechainEnabled || sidechainBlock.getNumChannels() == 0 || context.isBypassed || designSource != nullptr || isPresetMorphing())
+            {
+                process(context);
+                return;
+            }
+
+            jassert(sidechainBlock.getNumSamples() == context.getOutputBlock().getNumSamples());
+
+            update(static_cast<int>(context.getOutputBlock().getNumSamples()));
+
+            processDynamic(context, sidechainBlock);
+        }
+
+        /*
+            Audio rate modulation, one buffer of each per block shared by all channels, either may be nullptr.
+            cutoffOctaves offsets the cutoff in octaves and qOffset is added to the (auto) q.
+
+            Cutoff is read from a prewarped lookup table indexed by log2 frequency, so there are no
+            per sample transcendental calls. The trapezoidal SVF stays stable for any g, k > 0 so the
+            cutoff is clamped below nyquist and q to a small positive minimum.
+            Dynamic eq gain is not applied while modulating.
+        */
+        template<typename ProcessContext = juce::dsp::ProcessContextReplacing<float>>
+        void process(const ProcessContext& context, const SampleType* cutoffOctaves, const SampleType* qOffset) noexcept
+        {
+            const auto& inputBlock = context.getInputBlock();
+            auto& outputBlock = context.getOutputBlock();
+
+            jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+            jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
+            jassert(inputBlock.getNumChannels() <= filters.size());
+
+            const auto numSamples = outputBlock.getNumSamples();
+
+            if (context.isBypassed || filterType == FilterType::none)
+            {
+                skip(static_cast<int>(numSamples));
+
+                if (context.usesSeparateInputAndOutputBlocks())
+                    outputBlock.copyFrom(inputBlock);
+
+                return;
+            }
+
+            if (cutoffOctaves == nullptr && qOffset == nullptr)
+            {
+                process(context);
+                return;
+            }
+
+            update(static_cast<int>(numSamples));
+            updateModulationBase();
+
+            for (size_t start = 0; start < numSamples; start += modulationBlockSize)
+            {
+                const auto num = juce::jmin(modulationBlockSize, numSamples - start);
+
+                fillModulatedCoefficients(cutoffOctaves != nullptr ? cutoffOctaves + start : nullptr,
+                                          qOffset != nullptr ? qOffset + start : nullptr,
+                                          num);
+
+                for (size_t channel = 0; channel != inputBlock.getNumChannels(); ++channel)
+                {
+                    filters[channel].processModulated(inputBlock.getChannelPointer(channel) + start,
+                                                      outputBlock.getChannelPointer(channel) + start,
+                                                      num,
+                                                      modA1.data(), modA2.data(), modA3.data(), modM1.data(),
+                                                      modM0, modM2);
+                }
+            }
         }
 
     private:
+        // processes in control rate sub blocks, updating the gain from the detector once per sub block
+        template<typename ProcessContext, typename DetectorBlock>
+        void processDynamic(const ProcessContext& context, const DetectorBlock& detectorBlock) noexcept
+        {
+            const auto& inputBlock = context.getInputBlock();
+            auto& outputBlock = context.getOutputBlock();
+
+            const auto numSamples = outputBlock.getNumSamples();
+            const auto numDetectorChannels = detectorBlock.getNumChannels();
+
+            for (size_t start = 0; start < numSamples; start += controlInterval)
+            {
+                const auto num = juce::jmin(controlInterval, numSamples - start);
+
+                // peak level over the sub block, linked across channels
+                auto level = static_cast<SampleType>(0);
+
+                for (size_t channel = 0; channel != numDetectorChannels; ++channel)
+                {
+                    const auto* detector = detectorBlock.getChannelPointer(channel) + start;
+
+                    for (size_t sample = 0; sample != num; ++sample)
+                        level = juce::jmax(level, std::abs(detector[sample]));
+                }
+
+                updateDynamicGain(level);
+
+                auto subOutput = outputBlock.getSubBlock(start, num);
+
+                // in place the two sub blocks are the same memory, which a non replacing context doesn't allow
+                if (context.usesSeparateInputAndOutputBlocks())
+                    processFilters(juce::dsp::ProcessContextNonReplacing<SampleType>(inputBlock.getSubBlock(start, num), subOutput));
+                else
+                    processFilters(juce::dsp::ProcessContextReplacing<SampleType>(subOutput));
+            }
+        }
+
+        // every coefficient per sample, linear in g, k and the mix
+        template<typename ProcessContext>
+        void processPresetMorph(const ProcessContext& context) noexcept
+        {
+            const auto& inputBlock = context.getInputBlock();
+            auto& outputBlock = context.getOutputBlock();
+
+            jassert(inputBlock.getNumChannels() <= filters.size());
+
+            const auto numSamples = outputBlock.getNumSamples();
+
+            for (size_t start = 0; start < numSamples; start += modulationBlockSize)
+            {
+                const auto num = juce::jmin(modulationBlockSize, numSamples - start);
+
+                fillPresetMorphCoefficients(num);
+
+                for (size_t channel = 0; channel != inputBlock.getNumChannels(); ++channel)
+                {
+                    filters[channel].processModulated(inputBlock.getChannelPointer(channel) + start,
+                                                      outputBlock.getChannelPointer(channel) + start,
+                                                      num,
+                                                      modA1.data(), modA2.data(), modA3.data(),
+                                                      morphM0.data(), morphM1.data(), morphM2.data());
+                }
+            }
+
+            endPresetMorphBlock();
+        }
+
+        // morph runs per sample, only the output mix changes so it is still a single recursion
+        template<typename ProcessContext>
+        void processMorphing(const ProcessContext& context) noexcept
+        {
+            const auto& inputBlock = context.getInputBlock();
+            auto& outputBlock = context.getOutputBlock();
+
+            jassert(inputBlock.getNumChannels() <= filters.size());
+
+            const auto numSamples = outputBlock.getNumSamples();
+            const auto k = state->data[static_cast<size_t>(2)];
+
+            for (size_t start = 0; start < numSamples; start += modulationBlockSize)
+            {
+                const auto num = juce::jmin(modulationBlockSize, numSamples - start);
+
+                for (size_t i = 0; i != num; ++i)
+                    VASVF::ArrayState<SampleType>::getMorphMix(morph.getNextValue(), k, morphM0[i], morphM1[i], morphM2[i]);
+
+                for (size_t channel = 0; channel != inputBlock.getNumChannels(); ++channel)
+                {
+                    filters[channel].processMixed(inputBlock.getChannelPointer(channel) + start,
+                                                  outputBlock.getChannelPointer(channel) + start,
+                                                  num,
+                                                  morphM0.data(), morphM1.data(), morphM2.data());
+                }
+            }
+        }
+
+        // multi-mono processing, every filter shares 'state'
+        template<typename ProcessContext>
+        void processFilters(const ProcessContext& context) noexcept
+        {
+            const auto& inputBlock = context.getInputBlock();
+            auto& outputBlock = context.getOutputBlock();
+
+            jassert(inputBlock.getNumChannels() <= filters.size());
+
+            for (size_t channel = 0; channel != inputBlock.getNumChannels(); ++channel)
+            {
+                auto outputChannel = outputBlock.getSingleChannelBlock(channel);
+
+                // a replacing context's channels alias, they can only be processed in place
+                if (context.usesSeparateInputAndOutputBlocks())
+                    filters[channel].process(juce::dsp::ProcessContextNonReplacing<SampleType>(inputBlock.getSingleChannelBlock(channel), outputChannel));
+                else
+                    filters[channel].process(juce::dsp::ProcessContextReplacing<SampleType>(outputChannel));
+            }
+        }
+
+        void updateDynamicGain(SampleType level) noexcept;
+
+        void prepareGainDesigner(FilterType type, SampleType f, SampleType g, SampleType qValue, bool aq) noexcept;
+
+        void publishState() noexcept;
+
+        void pickUpDesignedState() noexcept;
+
+        void fillPresetMorphCoefficients(size_t numSamples) noexcept;
+
+        void advancePresetMorph(int numSamples) noexcept;
+
+        void endPresetMorphBlock() noexcept;
+
+        void updateEnvelopeCoefficients() noexcept;
+
+        void fillPitchTable();
+
+        void updateModulationBase() noexcept;
+
+        void fillModulatedCoefficients(const SampleType* cutoffOctaves, const SampleType* qOffset, size_t numSamples) noexcept;
+
         double sampleRate{ 0.0 }, rampDurationSeconds{ 0.05 };
 
-        juce::dsp::ProcessorDuplicator<VASVF::Filter<SampleType>, VASVF::State<SampleType>> filterProcessor;
+        typename VASVF::State<SampleType>::Ptr state{ new VASVF::State<SampleType>(1, 1, 1, 0, 0, 0) };
+        std::vector<VASVF::Filter<SampleType>> filters;
  
         bool shouldUpdate{ true };
 
+        SeqLock<VASVF::StateSnapshot> stateSnapshot;
+
+        DesignSource* designSource{ nullptr };
+
         //=====================================================================
         VASVF::FilterType                       filterType  { FilterType::lowpass };
         bool                                    autoQ       { false };
         juce::LinearSmoothedValue<SampleType>   frequency   { 1000 };
         juce::LinearSmoothedValue<SampleType>   gain        { 0 };
         juce::LinearSmoothedValue<SampleType>   q           { gedd::MathConstants<SampleType>::reciprocalSqrt2 };
+        juce::LinearSmoothedValue<SampleType>   morph       { 0 };
+
+        std::vector<SampleType> morphM0, morphM1, morphM2;
+
+        //=====================================================================
+        // preset morph, coefficients as State::data
+        std::array<SampleType, 9> presetFrom{}, presetTo{};
+        SampleType presetMorphPosition{ 0 }, presetMorphStep{ 0 };
+        int presetMorphRemaining{ 0 };
+
+        //=====================================================================
+        // dynamic eq, envelope runs once every controlInterval samples
+        static constexpr size_t controlInterval{ 32 };
+
+        VASVF::GainDesigner<SampleType>         gainDesigner;
+        bool                                    dynamicsEnabled     { false };
+        bool                                    sidechainEnabled    { false };
+        SampleType                              threshold           { 0 };
+        SampleType                              ratio               { 2 };
+        SampleType                              attack              { 10 };
+        SampleType                              release             { 100 };
+        SampleType                              attackCoeff         { 0 };
+        SampleType                              releaseCoeff        { 0 };
+        SampleType                              staticGain          { 0 };
+        SampleType                              dynamicGain         { 0 };
+
+        //=====================================================================
+        // audio rate modulation
+        static constexpr size_t modulationBlockSize{ 256 };
+        static constexpr int pitchTableResolution{ 64 };  // points per octave
+
+        std::vector<SampleType> pitchTable;             // prewarped tan(pi f / fs) over log2 f
+        SampleType pitchTableStart{ 0 }, pitchTableEnd{ 0 };
+
+        // block rate base design
+        SampleType modLog2Frequency{ 0 }, modGScale{ 1 }, modQ{ 1 }, modK{ 1 }, modM1PerK{ 0 }, modM0{ 1 }, modM2{ 0 };
+
+        std::vector<SampleType> modA1, modA2, modA3, modM1;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VASVFProcessor)
     };
@@ -0,0 +1,214 @@
+/*
+  ==============================================================================
+
+    VASVFSaturatingFilter.cpp
+    Created: 19 Oct 2026 2:05:47pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "VASVFSaturatingFilter.h"
+
+namespace gedd {
+namespace dsp {
+namespace VASVF {
+
+template <typename NumericType>
+const TanhTable<NumericType>& TanhTable<NumericType>::get()
+{
+    static const TanhTable table;
+    return table;
+}
+
+template <typename NumericType>
+TanhTable<NumericType>::TanhTable()
+{
+    for (size_t i = 0; i != f.size(); ++i)
+    {
+        const auto x = static_cast<double>(i) / pointsPerUnit;
+
+        f[i] = static_cast<NumericType>(std::tanh(x));
+        F[i] = static_cast<NumericType>(x + std::log1p(std::exp(-2.0 * x)) - 0.69314718055994530942);
+    }
+}
+
+template <typename NumericType>
+NumericType TanhTable<NumericType>::tanh(NumericType x) const noexcept
+{
+    const auto ax = std::abs(x);
+
+    if (ax >= static_cast<NumericType>(range))
+        return x < 0 ? static_cast<NumericType>(-1) : static_cast<NumericType>(1);
+
+    // series in the first segment, keeps tanh(x) - x accurate for small signals
+    if (ax < static_cast<NumericType>(1) / static_cast<NumericType>(pointsPerUnit))
+        return x - x * x * x / static_cast<NumericType>(3);
+
+    const auto pos = ax * static_cast<NumericType>(pointsPerUnit);
+    const auto i = static_cast<size_t>(pos);
+    const auto t = pos - static_cast<NumericType>(i);
+
+    const auto y = f[i] + t * (f[i + 1] - f[i]);
+
+    return x < 0 ? -y : y;
+}
+
+template <typename NumericType>
+NumericType TanhTable<NumericType>::logCosh(NumericType x) const noexcept
+{
+    const auto ax = std::abs(x);
+
+    if (ax >= static_cast<NumericType>(range))
+        return ax - static_cast<NumericType>(0.69314718055994530942);
+
+    if (ax < static_cast<NumericType>(1) / static_cast<NumericType>(pointsPerUnit))
+    {
+        const auto x2 = x * x;
+        return static_cast<NumericType>(0.5) * x2 - x2 * x2 / static_cast<NumericType>(12);
+    }
+
+    const auto h = static_cast<NumericType>(1) / static_cast<NumericType>(pointsPerUnit);
+    const auto pos = ax * static_cast<NumericType>(pointsPerUnit);
+    const auto i = static_cast<size_t>(pos);
+    const auto t = pos - static_cast<NumericType>(i);
+
+    // cubic hermite, the slope of log(cosh(x)) is tanh(x)
+    const auto t2 = t * t;
+    const auto t3 = t2 * t;
+
+    const auto h00 = 2 * t3 - 3 * t2 + 1;
+    const auto h10 = t3 - 2 * t2 + t;
+    const auto h01 = 3 * t2 - 2 * t3;
+    const auto h11 = t3 - t2;
+
+    return h00 * F[i] + h10 * h * f[i] + h01 * F[i + 1] + h11 * h * f[i + 1];
+}
+
+template class TanhTable<float>;
+template class TanhTable<double>;
+
+//========================================================================
+template <typename SampleType>
+SaturatingFilter<SampleType>::SaturatingFilter()
+    : coeffs(new State<SampleType>(1, 1, 1, 0, 0, 0))
+{
+    reset();
+}
+
+template <typename SampleType>
+SaturatingFilter<SampleType>::SaturatingFilter(StatePtr s)
+    : coeffs(std::move(s))
+{
+    reset();
+}
+
+template <typename SampleType>
+void SaturatingFilter<SampleType>::setDrive(SampleType newDrive) noexcept
+{
+    jassert(newDrive >= 0);
+
+    if (newDrive == drive)
+        return;
+
+    // keep the ADAA history continuous across the change
+    lastU = drive > 0 ? lastU * (newDrive / drive) : static_cast<SampleType>(0);
+    lastR = residual(lastU);
+
+    drive = newDrive;
+    invDrive = drive > 0 ? static_cast<SampleType>(1) / drive : static_cast<SampleType>(1);
+}
+
+template <typename SampleType>
+void SaturatingFilter<SampleType>::prepare(const juce::dsp::ProcessSpec& spec) noexcept
+{
+    jassert(spec.sampleRate > 0);
+    jassert(spec.numChannels > 0);
+
+    reset();
+}
+
+template <typename SampleType>
+void SaturatingFilter<SampleType>::reset() noexcept
+{
+    std::fill(iceq.begin(), iceq.end(), static_cast<SampleType>(0));
+
+    lastU = 0;
+    lastR = 0;
+}
+
+template <typename SampleType>
+void SaturatingFilter<SampleType>::snapToZero() noexcept
+{
+    for (auto& v : iceq)
+        juce::dsp::util::snapToZero(v);
+}
+
+template <typename SampleType>
+SampleType SaturatingFilter<SampleType>::residual(SampleType u) const noexcept
+{
+    // antiderivative of tanh(u) - u
+    return table->logCosh(u) - static_cast<SampleType>(0.5) * u * u;
+}
+
+template <typename SampleType>
+SampleType SaturatingFilter<SampleType>::saturate(SampleType x) noexcept
+{
+    // below this the F difference is mostly rounding error
+    const auto tolerance = static_cast<SampleType>(std::is_same<SampleType, float>::value ? 1.0e-3 : 1.0e-6);
+
+    const auto u = drive * x;
+    const auto Ru = residual(u);
+    const auto du = u - lastU;
+
+    // only tanh(u) - u goes through ADAA, so the linear part has no half sample delay
+    // and a lightly driven filter keeps its linear response
+    auto y = static_cast<SampleType>(0);
+
+    if (std::abs(du) > tolerance)
+    {
+        y = (Ru - lastR) / du;
+    }
+    else
+    {
+        const auto mid = static_cast<SampleType>(0.5) * (u + lastU);
+        y = table->tanh(mid) - mid;
+    }
+
+    lastU = u;
+    lastR = Ru;
+
+    return (u + y) * invDrive;
+}
+
+template <typename SampleType>
+SampleType JUCE_VECTOR_CALLTYPE SaturatingFilter<SampleType>::processSample(SampleType v0) noexcept
+{
+    jassert(coeffs != nullptr);
+
+    const auto& s = coeffs->data;
+
+    auto& ic1 = iceq[static_cast<size_t>(0)];
+    auto& ic2 = iceq[static_cast<size_t>(1)];
+
+    const auto v3 = v0 - ic2;
+    auto v1 = s[static_cast<size_t>(6)] * ic1 + s[static_cast<size_t>(7)] * v3;
+
+    if (drive > 0)
+        v1 = saturate(v1);
+
+    // v2 = ic2 + g v1, same as the linear solve when undriven
+    const auto v2 = ic2 + s[static_cast<size_t>(1)] * v1;
+
+    ic1 = static_cast<SampleType>(2) * v1 - ic1;
+    ic2 = static_cast<SampleType>(2) * v2 - ic2;
+
+    return s[static_cast<size_t>(3)] * v0 + s[static_cast<size_t>(4)] * v1 + s[static_cast<size_t>(5)] * v2;
+}
+
+template class SaturatingFilter<float>;
+template class SaturatingFilter<double>;
+
+}   // namespace VASVF
+}   // namespace dsp
+}   // namespace gedd
@@ -0,0 +1,146 @@
+/*
+  ==============================================================================
+
+    VASVFSaturatingFilter.h
+    Created: 19 Oct 2026 2:05:47pm
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "VASVF.h"
+
+namespace gedd {
+namespace dsp {
+namespace VASVF {
+
+    /*
+        tanh and its antiderivative log(cosh(x)) as lookup tables over [0, range],
+        odd / even symmetry covers negative inputs and past the range both are
+        replaced by their asymptotes. F is interpolated with a cubic hermite using
+        f as the slope, so ADAA differences of F stay consistent with f. The first
+        segment uses a short series instead, so tanh(x) - x stays accurate near 0.
+
+        One shared instance per type, built on first use of get().
+    */
+    template <typename NumericType>
+    class TanhTable
+    {
+    public:
+        static const TanhTable& get();
+
+        NumericType tanh(NumericType x) const noexcept;
+
+        NumericType logCosh(NumericType x) const noexcept;
+
+        static constexpr int pointsPerUnit{ 32 };
+        static constexpr int range{ 8 };
+
+    private:
+        TanhTable();
+
+        std::array<NumericType, pointsPerUnit * range + 2> f, F;
+    };
+
+    /*
+        VASVF with a tanh nonlinearity on the bandpass integrator, for analog style drive.
+
+        The nonlinearity uses first order antiderivative anti-aliasing,
+        y = (F(u) - F(u')) / (u - u'), so it is usable at 1x or 2x rate without
+        heavy oversampling. Both F and f come from TanhTable, no transcendental
+        calls per sample.
+
+        ADAA is only applied to tanh(u) - u, its half sample of delay would
+        otherwise detune the resonance even when barely driven.
+        Drive is linear input gain into the nonlinearity, 0 is a clean (linear) filter.
+    */
+    template <typename SampleType>
+    class SaturatingFilter
+    {
+    public:
+        using StatePtr = typename State<SampleType>::Ptr;
+
+        // Constructor
+        SaturatingFilter();
+
+        // Create filter with given coeffs
+        SaturatingFilter(StatePtr stateToUse);
+
+        SaturatingFilter(const SaturatingFilter&) = default;
+        SaturatingFilter(SaturatingFilter&&) = default;
+        SaturatingFilter& operator=(const SaturatingFilter&) = default;
+        SaturatingFilter& operator=(SaturatingFilter&&) = default;
+
+        StatePtr coeffs;
+
+        // setters
+        void setDrive(SampleType newDrive) noexcept;
+
+        SampleType getDrive() const noexcept { return drive; }
+
+        // Dsp methods
+        void prepare(const juce::dsp::ProcessSpec& spec) noexcept;
+
+        void reset() noexcept;
+
+        void snapToZero() noexcept;
+
+        SampleType JUCE_VECTOR_CALLTYPE processSample(SampleType v0) noexcept;
+
+        template<typename ProcessContext>
+        void process(const ProcessContext& context) noexcept
+        {
+            static_assert(std::is_same<typename ProcessContext::SampleType, SampleType>::value,
+                "The sample-type of the VASVF filter must match the sample-type supplied to this process callback");
+
+            jassert(coeffs != nullptr);
+
+            auto&& inputBlock = context.getInputBlock();
+            auto&& outputBlock = context.getOutputBlock();
+
+            jassert(inputBlock.getNumChannels() == 1);
+            jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+            jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
+
+            if (context.isBypassed)
+            {
+                if (context.usesSeparateInputAndOutputBlocks())
+                    outputBlock.copyFrom(inputBlock);
+
+                return;
+            }
+
+            const auto numSamples = inputBlock.getNumSamples();
+            const auto* src = inputBlock.getChannelPointer(0);
+            auto* dst = outputBlock.getChannelPointer(0);
+
+            for (size_t sample = 0; sample != numSamples; ++sample)
+                dst[sample] = processSample(src[sample]);
+
+#if JUCE_SNAP_TO_ZERO
+            snapToZero();
+#endif
+        }
+
+    private:
+        // first order ADAA of tanh(drive * x) / drive
+        SampleType saturate(SampleType x) noexcept;
+
+        SampleType residual(SampleType u) const noexcept;
+
+        const TanhTable<SampleType>* table{ &TanhTable<SampleType>::get() };
+
+        std::array<SampleType, 2> iceq;
+
+        SampleType drive{ 0 }, invDrive{ 1 };
+        SampleType lastU{ 0 }, lastR{ 0 };
+
+        JUCE_LEAK_DETECTOR(SaturatingFilter)
+    };
+
+}   // namespace VASVF
+}   // namespace dsp
+}   // namespace gedd
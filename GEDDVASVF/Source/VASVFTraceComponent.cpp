@@ -11,11 +11,13 @@
 #include "VASVFTraceComponent.h"
 
 //==============================================================================
-VASVFTraceComponent::VASVFTraceComponent(EQParameterReference& ref)
-    : freq(ref.freq),
+VASVFTraceComponent::VASVFTraceComponent(EQParameterReference& ref, double offscreenScaleToUse)
+    : offscreenScale(offscreenScaleToUse),
+    freq(ref.freq),
     gain(ref.gain),
     q(ref.q),
     autoq(ref.autoq),
+    morph(ref.morph),
     filterType(ref.type)
 {
     setOpaque(false);
@@ -26,20 +28,24 @@ VASVFTraceComponent::VASVFTraceComponent(EQParameterReference& ref)
 
     setColour(magnitudeTraceColourID, juce::Colours::red);
     setColour(phaseTraceColourID, juce::Colours::blue.brighter());
+    setColour(groupDelayTraceColourID, juce::Colours::green.brighter());
 
     freq.addListener(this);
     gain.addListener(this);
     q.addListener(this);
     autoq.addListener(this);
+    morph.addListener(this);
     filterType.addListener(this);
 
-    frequencies.resize(numPoints);
-    magnitudes.resize(numPoints);
-    phases.resize(numPoints);
+    jassert(offscreenScale >= 0.0);
 
-    fillFrequencyVector();
+    if (!isOffscreen())
+        traceThread->addClient(this);
 
     update();
+
+    if (!isOffscreen())
+        startTimerHz(maxFrameRate);
 }
 
 VASVFTraceComponent::~VASVFTraceComponent()
@@ -48,78 +54,207 @@ VASVFTraceComponent::~VASVFTraceComponent()
     gain.removeListener(this);
     q.removeListener(this);
     autoq.removeListener(this);
+    morph.removeListener(this);
     filterType.removeListener(this);
+
+    // waits for a trace in progress, nothing to do if this was never a client
+    traceThread->removeTimeSliceClient(this);
 }
 
 void VASVFTraceComponent::paint (juce::Graphics& g)
 {
-    if (showMagnitudes && !frequencyPath.isEmpty())
+    const auto& paths = results.getReadBuffer();
+
+    if (showMagnitudes && !paths.magnitude.isEmpty())
     {
         g.setColour(findColour(magnitudeTraceColourID));
-        g.strokePath(frequencyPath, juce::PathStrokeType(1.5f));
+        g.strokePath(paths.magnitude, juce::PathStrokeType(1.5f));
     }
 
-    if (showPhases && !phasePath.isEmpty())
+    if (showPhases && !paths.phase.isEmpty())
     {
         g.setColour(findColour(phaseTraceColourID));
-        g.strokePath(phasePath, juce::PathStrokeType(1.5f));
+        g.strokePath(paths.phase, juce::PathStrokeType(1.5f));
+    }
+
+    if (showGroupDelays && !paths.groupDelay.isEmpty())
+    {
+        g.setColour(findColour(groupDelayTraceColourID));
+        g.strokePath(paths.groupDelay, juce::PathStrokeType(1.5f));
     }
 }
 
 void VASVFTraceComponent::resized()
 {
-    update();
+    triggerUpdate();
 }
 
 void VASVFTraceComponent::update()
 {
     using FilterType = gedd::dsp::VASVF::FilterType;
-    using State = gedd::dsp::VASVF::State<double>;
 
-    // create state from params
-    const auto sr = sampleRate;
-    const auto sf = freq.getNormalisableRange().convertFrom0to1(freq.getValue());
-    const auto sg = gain.getNormalisableRange().convertFrom0to1(gain.getValue());
-    const auto sq = q.getNormalisableRange().convertFrom0to1(q.getValue());
-    const auto aq = autoq.getNormalisableRange().convertFrom0to1(autoq.getValue());
-    const auto t = static_cast<FilterType>(filterType.getNormalisableRange().convertFrom0to1(filterType.getValue()));
+    auto& request = requests.getWriteBuffer();
 
-    jassert(sr > 0);    // sample rate in range
-    jassert(sf > 0);    // frequency in range
-    jassert(sq > 0);    // q in range
+    // parameters, reading them is cheap, the state is designed on the trace thread
+    request.frequency = freq.getNormalisableRange().convertFrom0to1(freq.getValue());
+    request.gain = gain.getNormalisableRange().convertFrom0to1(gain.getValue());
+    request.q = q.getNormalisableRange().convertFrom0to1(q.getValue());
+    request.autoQ = autoq.getNormalisableRange().convertFrom0to1(autoq.getValue()) > 0.5f;
+    request.morph = morph.getNormalisableRange().convertFrom0to1(morph.getValue());
+    request.type = static_cast<FilterType>(filterType.getNormalisableRange().convertFrom0to1(filterType.getValue()));
 
-    State::Ptr newState;
+    request.hasState = false;
 
-    switch (t)
+    if (stateSource != nullptr)
     {
-    case FilterType::none:      newState = new State(); break;
-    case FilterType::lowpass:   newState = State::makeLowpass(sr, sf, sg, sq, aq);   break;
-    case FilterType::bandpass:  newState = State::makeBandpass(sr, sf, sg, sq, aq);  break;
-    case FilterType::highpass:  newState = State::makeHighpass(sr, sf, sg, sq, aq);  break;
-    case FilterType::notch:     newState = State::makeNotch(sr, sf, sg, sq, aq);     break;
-    case FilterType::allpass:   newState = State::makeAllpass(sr, sf, sg, sq, aq);   break;
-    case FilterType::bell:      newState = State::makeBell(sr, sf, sg, sq, aq);      break;
-    case FilterType::lowshelf:  newState = State::makeLowshelf(sr, sf, sg, sq, aq);  break;
-    case FilterType::highshelf: newState = State::makeHighshelf(sr, sf, sg, sq, aq); break;
+        const auto sequence = stateSource->getSequence();
+        gedd::dsp::VASVF::StateSnapshot snapshot;
+
+        // nothing published yet (sample rate 0) draws from the parameters
+        if (stateSource->load(snapshot) && snapshot.sampleRate > 0.0)
+        {
+            stateSequence = sequence;
+
+            request.hasState = true;
+            request.stateData = snapshot.data;
+
+            if (snapshot.sampleRate != sampleRate)
+            {
+                sampleRate = snapshot.sampleRate;
+                ++frequencyVersion;
+            }
+        }
     }
 
-    // if successful then update trace
-    if (newState)
+    // display
+    request.sampleRate = sampleRate;
+    request.numPoints = numPoints;
+    request.pointsPerPixel = pointsPerPixel;
+    request.frequencyVersion = frequencyVersion;
+    request.frequencyRange = frequencyRange;
+    request.decibelRange = decibelRange;
+    request.bounds = getLocalBounds();
+
+    if (isOffscreen())
     {
-        displayState = *newState;
-        redraw();
+        request.pixelScale = offscreenScale;
+    }
+    else
+    {
+        request.pixelScale = static_cast<double>(getDesktopScaleFactor());
+
+        if (auto* display = juce::Desktop::getInstance().getDisplays().getDisplayForRect(getScreenBounds()))
+            request.pixelScale *= display->scale;
+    }
+
+    request.showGroupDelays = showGroupDelays;
+    request.groupDelayRange = groupDelayRange;
+
+    jassert(request.sampleRate > 0);    // sample rate in range
+    jassert(request.frequency > 0);     // frequency in range
+    jassert(request.q > 0);             // q in range
+
+    requests.publish();
+
+    if (isOffscreen())
+    {
+        // nothing else touches the buffers while offscreen
+        requests.acquire();
+        computeTrace(requests.getReadBuffer(), results.getWriteBuffer());
+        results.publish();
+
+        results.acquire();
+        repaint();
+    }
+    else
+    {
+        traceThread->moveToFrontOfQueue(this);
     }
 }
 
 void VASVFTraceComponent::setNumPoints(int newNumPoints)
 {
+    jassert(newNumPoints == 0 || newNumPoints >= 2);
+
     if (newNumPoints != numPoints)
     {
         numPoints = newNumPoints;
 
-        fillFrequencyVector();
+        ++frequencyVersion;
 
-        update();
+        triggerUpdate();
+    }
+}
+
+void VASVFTraceComponent::setStateSource(const gedd::SeqLock<gedd::dsp::VASVF::StateSnapshot>* newSource)
+{
+    if (newSource != stateSource)
+    {
+        stateSource = newSource;
+
+        triggerUpdate();
+    }
+}
+
+void VASVFTraceComponent::setMaxFrameRate(int framesPerSecond)
+{
+    jassert(framesPerSecond > 0);
+
+    if (framesPerSecond != maxFrameRate)
+    {
+        maxFrameRate = framesPerSecond;
+
+        if (!isOffscreen())
+            startTimerHz(maxFrameRate);
+    }
+}
+
+void VASVFTraceComponent::setOffscreenScale(double newScale)
+{
+    jassert(newScale >= 0.0);
+
+    if (newScale == offscreenScale)
+        return;
+
+    const auto wasOffscreen = isOffscreen();
+    offscreenScale = newScale;
+
+    if (isOffscreen() && !wasOffscreen)
+    {
+        // waits for a trace in progress, after this the buffers are only used here
+        stopTimer();
+        traceThread->removeTimeSliceClient(this);
+    }
+    else if (!isOffscreen() && wasOffscreen)
+    {
+        traceThread->addClient(this);
+        startTimerHz(maxFrameRate);
+    }
+
+    update();
+}
+
+void VASVFTraceComponent::setPointsPerPixel(double newPointsPerPixel)
+{
+    jassert(newPointsPerPixel > 0.0);
+
+    if (newPointsPerPixel != pointsPerPixel)
+    {
+        pointsPerPixel = newPointsPerPixel;
+
+        triggerUpdate();
+    }
+}
+
+void VASVFTraceComponent::setGroupDelayRange(double maxMilliseconds)
+{
+    jassert(maxMilliseconds > 0.0);
+
+    if (maxMilliseconds != groupDelayRange)
+    {
+        groupDelayRange = maxMilliseconds;
+
+        triggerUpdate();
     }
 }
 
@@ -137,8 +272,8 @@ void VASVFTraceComponent::setFrequencyRange(juce::Range<double> r)
         frequencyRange.start = r.getStart();
         frequencyRange.end = r.getEnd();
 
-        fillFrequencyVector();
-        update();
+        ++frequencyVersion;
+        triggerUpdate();
     }
 }
 
@@ -148,8 +283,8 @@ void VASVFTraceComponent::setFrequencyNormalisableRange(juce::NormalisableRange<
 
     frequencyRange = r;
 
-    fillFrequencyVector();
-    redraw();
+    ++frequencyVersion;
+    triggerUpdate();
 }
 
 void VASVFTraceComponent::setDecibelRange(double bottom, double top)
@@ -166,7 +301,7 @@ void VASVFTraceComponent::setDecibelRange(juce::Range<double> r)
         decibelRange.start = r.getStart();
         decibelRange.end = r.getEnd();
 
-        update();
+        triggerUpdate();
     }
 }
 
@@ -176,7 +311,7 @@ void VASVFTraceComponent::setDecibelNormalisableRange(juce::NormalisableRange<do
 
     decibelRange = r;
 
-    redraw();
+    triggerUpdate();
 }
 
 void VASVFTraceComponent::setSampleRate(double newSampleRate)
@@ -187,107 +322,321 @@ void VASVFTraceComponent::setSampleRate(double newSampleRate)
     {
         sampleRate = newSampleRate;
 
-        update();
+        ++frequencyVersion;
+        triggerUpdate();
     }
 }
 
-void VASVFTraceComponent::redraw() noexcept
+void VASVFTraceComponent::parameterValueChanged(int parameterIndex, float newValue)
+{
+    triggerUpdate();
+}
+
+void VASVFTraceComponent::timerCallback()
+{
+    // the processor published new coefficients
+    if (stateSource != nullptr && stateSource->getSequence() != stateSequence)
+        needsUpdate = true;
+
+    // published while the trace thread was rescheduling this client, which overwrote the wake up
+    if (requests.hasNewValue())
+        traceThread->moveToFrontOfQueue(this);
+
+    if (needsUpdate.exchange(false))
+        update();
+
+    if (results.acquire())
+        repaint();
+}
+
+//==============================================================================
+int VASVFTraceComponent::useTimeSlice()
 {
-    updateMagnitudes();
-    updatePhases();
-    createMagnitudePlot();
-    createPhasePlot();
-    repaint();
+    // update() wakes this client for every request, so an idle trace hardly ever runs.
+    // A request missed while the thread was rescheduling it is caught by the next frame
+    constexpr auto idleMilliseconds = 1000;
+
+    if (!requests.acquire())
+        return idleMilliseconds;
+
+    computeTrace(requests.getReadBuffer(), results.getWriteBuffer());
+    results.publish();
+
+    return requests.hasNewValue() ? 0 : idleMilliseconds;
 }
 
-void VASVFTraceComponent::handleUpdate() noexcept
+void VASVFTraceComponent::computeTrace(const TraceRequest& request, TracePaths& paths)
 {
-    if (juce::MessageManager::getInstance()->isThisTheMessageThread())
+    const auto numBasePoints = getNumBasePoints(request);
+
+    if (numBasePoints < 2 || request.bounds.isEmpty())
     {
-        cancelPendingUpdate();
-        handleAsyncUpdate();
+        paths.magnitude.clear();
+        paths.phase.clear();
+        paths.groupDelay.clear();
+        return;
     }
-    else
+
+    if (request.frequencyVersion != computedFrequencyVersion || baseFrequencies.size() != static_cast<size_t>(numBasePoints))
+        fillFrequencyVector(request, numBasePoints);
+
+    makeDisplayState(request);
+    updateResponse(request);
+
+    addResonancePoints(request);
+    evaluateResonancePoints(request);
+    mergePoints(request);
+
+    createMagnitudePlot(request, paths.magnitude);
+    createPhasePlot(request, paths.phase);
+    createGroupDelayPlot(request, paths.groupDelay);
+}
+
+void VASVFTraceComponent::makeDisplayState(const TraceRequest& request)
+{
+    using ArrayState = gedd::dsp::VASVF::ArrayState<double>;
+
+    if (request.hasState)
     {
-        triggerAsyncUpdate();
+        displayState.data = request.stateData;
+        return;
     }
+
+    // built from the array version, no new state is allocated for every trace
+    displayState = gedd::dsp::VASVF::State<double>(ArrayState::make(request.type, request.sampleRate, request.frequency, request.gain,
+                                                                    request.q, request.autoQ, request.morph));
 }
 
-void VASVFTraceComponent::parameterValueChanged(int parameterIndex, float newValue)
+int VASVFTraceComponent::getNumBasePoints(const TraceRequest& request) noexcept
 {
-    handleUpdate();
+    if (request.numPoints > 0)
+        return request.numPoints;
+
+    const auto physicalWidth = static_cast<double>(request.bounds.getWidth()) * request.pixelScale;
+
+    return juce::jlimit(minPoints, maxPoints, juce::roundToInt(physicalWidth * request.pointsPerPixel));
 }
 
-void VASVFTraceComponent::handleAsyncUpdate()
+void VASVFTraceComponent::fillFrequencyVector(const TraceRequest& request, int numBasePoints)
 {
-    update();
+    const auto num = static_cast<size_t>(numBasePoints);
+    const auto maxExtra = static_cast<size_t>(maxResonances * pointsPerResonance);
+
+    baseFrequencies.resize(num);
+    baseMagnitudes.resize(num);
+    basePhases.resize(num);
+    baseGroupDelays.resize(num);
+
+    extraFrequencies.resize(maxExtra);
+    extraMagnitudes.resize(maxExtra);
+    extraPhases.resize(maxExtra);
+    extraGroupDelays.resize(maxExtra);
+
+    // merged sizes change every trace, reserving here keeps that allocation free
+    positions.reserve(num + maxExtra);
+    frequencies.reserve(num + maxExtra);
+    magnitudes.reserve(num + maxExtra);
+    phases.reserve(num + maxExtra);
+    groupDelays.reserve(num + maxExtra);
+
+    auto resolution = 1.0 / static_cast<double>(num - 1);
+
+    for (size_t i = 0; i != num; ++i)
+        baseFrequencies[i] = request.frequencyRange.convertFrom0to1(static_cast<double>(i) * resolution);
+
+    responseTable.setFrequencies(baseFrequencies.data(), baseFrequencies.size(), request.sampleRate);
+
+    computedFrequencyVersion = request.frequencyVersion;
 }
 
-void VASVFTraceComponent::fillFrequencyVector()
+void VASVFTraceComponent::updateResponse(const TraceRequest& request)
 {
-    jassert(frequencies.size() == numPoints);
+    jassert(responseTable.getNumFrequencies() == baseFrequencies.size());
 
-    auto resolution = 1.0 / static_cast<double>(numPoints - 1);
+    displayState.getResponseForFrequencyArray(responseTable, baseMagnitudes.data(), basePhases.data());
 
-    for (auto i = 0; i != numPoints; ++i)
-        frequencies[i] = frequencyRange.convertFrom0to1(static_cast<double>(i) * resolution);
+    if (request.showGroupDelays)
+        displayState.getGroupDelayForFrequencyArray(responseTable, baseGroupDelays.data());
+}
+
+void VASVFTraceComponent::addResonancePoints(const TraceRequest& request)
+{
+    numExtraPoints = 0;
+
+    if (request.type == gedd::dsp::VASVF::FilterType::none)
+        return;
+
+    const auto& range = request.frequencyRange;
+    const auto sr = request.sampleRate;
+    const auto hzPerRadian = sr / juce::MathConstants<double>::twoPi;
+    const auto step = 1.0 / static_cast<double>(baseFrequencies.size() - 1);
+
+    auto addResonance = [&](juce::dsp::Complex<double> root, double radius)
+    {
+        // real roots don't make a peak or a dip
+        if (std::abs(root.imag()) < 1.0e-9)
+            return;
+
+        const auto centre = std::abs(std::arg(root)) * hzPerRadian;
+        const auto halfBandwidth = juce::jmax(1.0 - radius, 1.0e-6) * hzPerRadian;
+
+        if (centre <= range.start || centre >= range.end)
+            return;
+
+        // base grid spacing around the centre, if it already resolves the bandwidth nothing is needed
+        const auto proportion = range.convertTo0to1(centre);
+        const auto spacing = 0.5 * (range.convertFrom0to1(juce::jmin(1.0, proportion + step))
+                                  - range.convertFrom0to1(juce::jmax(0.0, proportion - step)));
+
+        if (spacing < 0.25 * halfBandwidth)
+            return;
+
+        // the phase of a resonance goes as atan((f - centre) / halfBandwidth), equal steps of it put
+        // the points where the curve bends, out to where the base grid takes over
+        const auto maxAngle = std::atan(spacing / halfBandwidth);
+
+        for (auto i = 0; i != pointsPerResonance; ++i)
+        {
+            const auto angle = maxAngle * (2.0 * static_cast<double>(i) / static_cast<double>(pointsPerResonance - 1) - 1.0);
+            const auto f = centre + halfBandwidth * std::tan(angle);
+
+            if (f > range.start && f < range.end)
+                extraFrequencies[numExtraPoints++] = f;
+        }
+    };
+
+    const auto pz = displayState.getPolesAndZeros();
+    const auto poleRadius = pz.numPoles == 2 ? std::abs(pz.poles[0]) : 0.0;
+
+    if (pz.numPoles == 2)
+        addResonance(pz.poles[0], poleRadius);
+
+    // zeros on the unit circle are a notch as wide as the poles make it
+    if (pz.numZeros == 2)
+        addResonance(pz.zeros[0], juce::jmin(std::abs(pz.zeros[0]), poleRadius));
+
+    std::sort(extraFrequencies.begin(), extraFrequencies.begin() + static_cast<std::ptrdiff_t>(numExtraPoints));
 }
 
-void VASVFTraceComponent::updateMagnitudes()
+void VASVFTraceComponent::evaluateResonancePoints(const TraceRequest& request)
 {
-    displayState.getMagnitudeForFrequencyArray(frequencies.data(), magnitudes.data(), frequencies.size(), sampleRate);
+    if (numExtraPoints == 0)
+        return;
+
+    displayState.getResponseForFrequencyArray(extraFrequencies.data(), extraMagnitudes.data(), extraPhases.data(),
+                                              numExtraPoints, request.sampleRate);
+
+    if (request.showGroupDelays)
+        displayState.getGroupDelayForFrequencyArray(extraFrequencies.data(), extraGroupDelays.data(), numExtraPoints, request.sampleRate);
 }
 
-void VASVFTraceComponent::updatePhases()
+void VASVFTraceComponent::mergePoints(const TraceRequest& request)
 {
-    displayState.getPhaseForFrequencyArray(frequencies.data(), phases.data(), frequencies.size(), sampleRate);
+    const auto numBase = baseFrequencies.size();
+    const auto resolution = 1.0 / static_cast<double>(numBase - 1);
+
+    positions.clear();
+    frequencies.clear();
+    magnitudes.clear();
+    phases.clear();
+    groupDelays.clear();
+
+    auto add = [&](double position, double f, double m, double p, double d)
+    {
+        positions.push_back(position);
+        frequencies.push_back(f);
+        magnitudes.push_back(m);
+        phases.push_back(p);
+        groupDelays.push_back(d);
+    };
+
+    size_t extra = 0;
+
+    for (size_t i = 0; i != numBase; ++i)
+    {
+        for (; extra != numExtraPoints && extraFrequencies[extra] < baseFrequencies[i]; ++extra)
+            add(request.frequencyRange.convertTo0to1(extraFrequencies[extra]), extraFrequencies[extra],
+                extraMagnitudes[extra], extraPhases[extra], extraGroupDelays[extra]);
+
+        add(static_cast<double>(i) * resolution, baseFrequencies[i], baseMagnitudes[i], basePhases[i], baseGroupDelays[i]);
+    }
 }
 
-void VASVFTraceComponent::createMagnitudePlot()
+void VASVFTraceComponent::createMagnitudePlot(const TraceRequest& request, juce::Path& path) const
 {
-    const auto bounds = getLocalBounds();
-    const auto xScale = static_cast<double>(bounds.getWidth()) / static_cast<double>(numPoints - 1);
-    const auto gainFloor = static_cast<double>(juce::Decibels::decibelsToGain(decibelRange.start));
-    const auto gainCeiling = static_cast<double>(juce::Decibels::decibelsToGain(decibelRange.end));
+    const auto bounds = request.bounds;
+    const auto numPoints = static_cast<int>(positions.size());
+    const auto gainFloor = static_cast<double>(juce::Decibels::decibelsToGain(request.decibelRange.start));
+    const auto gainCeiling = static_cast<double>(juce::Decibels::decibelsToGain(request.decibelRange.end));
 
-    frequencyPath.clear();
-    frequencyPath.preallocateSpace(3 * numPoints);
+    path.clear();
+    path.preallocateSpace(3 * numPoints);
 
     for (auto i = 0; i != numPoints; ++i)
     {
-        const auto xPos = static_cast<double>(bounds.getX() + i) * xScale;
-        const auto db = decibelRange.convertTo0to1(decibelRange.snapToLegalValue(juce::Decibels::gainToDecibels(magnitudes[i])));
+        const auto xPos = bounds.getX() + positions[i] * bounds.getWidth();
+        const auto db = request.decibelRange.convertTo0to1(request.decibelRange.snapToLegalValue(juce::Decibels::gainToDecibels(magnitudes[i])));
         const auto yPos = bounds.getHeight() - ((db * bounds.getHeight()) + bounds.getY());
 
         // plot
         if (i == 0)
-            frequencyPath.startNewSubPath(xPos, yPos);
+            path.startNewSubPath(xPos, yPos);
         else
-            frequencyPath.lineTo(xPos, yPos);
+            path.lineTo(xPos, yPos);
     }
 }
 
-void VASVFTraceComponent::createPhasePlot()  // rather than db shouldn't it be in phases?
+void VASVFTraceComponent::createPhasePlot(const TraceRequest& request, juce::Path& path) const
 {
-    auto bounds = getLocalBounds();
-    const auto xScale = static_cast<double>(bounds.getWidth()) / static_cast<double>(numPoints - 1);
+    auto bounds = request.bounds;
+    const auto numPoints = static_cast<int>(positions.size());
     const auto phaseFloor = -juce::MathConstants<double>::pi;
     const auto phaseCeiling = juce::MathConstants<double>::pi;
 
-    phasePath.clear();
-    phasePath.preallocateSpace(3 * numPoints);
+    path.clear();
+    path.preallocateSpace(3 * numPoints);
 
     for (auto i = 0; i != numPoints; ++i)
     {
         const auto phase = juce::jlimit(phaseFloor, phaseCeiling, phases[i]) * gedd::MathConstants<double>::reciprocalTwopi;
 
-        const auto xPos = static_cast<double>(bounds.getX() + i) * xScale;
+        const auto xPos = bounds.getX() + positions[i] * bounds.getWidth();
         const auto yPos = bounds.getCentreY() - ((phase * bounds.getHeight()) + bounds.getY());
 
         // plot
         if (i == 0)
-            phasePath.startNewSubPath(xPos, yPos);
+            path.startNewSubPath(xPos, yPos);
+        else
+            path.lineTo(xPos, yPos);
+    }
+}
+
+void VASVFTraceComponent::createGroupDelayPlot(const TraceRequest& request, juce::Path& path) const
+{
+    path.clear();
+
+    if (!request.showGroupDelays)
+        return;
+
+    const auto bounds = request.bounds;
+    const auto numPoints = static_cast<int>(positions.size());
+
+    // samples to a 0..1 proportion of the range in ms
+    const auto scale = 1000.0 / (request.sampleRate * request.groupDelayRange);
+
+    path.preallocateSpace(3 * numPoints);
+
+    for (auto i = 0; i != numPoints; ++i)
+    {
+        const auto delay = juce::jlimit(0.0, 1.0, groupDelays[i] * scale);
+
+        const auto xPos = bounds.getX() + positions[i] * bounds.getWidth();
+        const auto yPos = bounds.getHeight() - ((delay * bounds.getHeight()) + bounds.getY());
+
+        // plot
+        if (i == 0)
+            path.startNewSubPath(xPos, yPos);
         else
-            phasePath.lineTo(xPos, yPos);
+            path.lineTo(xPos, yPos);
     }
 }
@@ -14,22 +14,27 @@
 #include "VASVFProcessor.h"
 #include "ParameterReference.h"
 #include "CommonFunctions.h"
+#include "TripleBuffer.h"
+#include "SeqLock.h"
 
 //==============================================================================
 /*
 */
 class VASVFTraceComponent  : public juce::Component,
                              private juce::RangedAudioParameter::Listener,
-                             private juce::AsyncUpdater
+                             private juce::Timer,
+                             private juce::TimeSliceClient
 {
 public:
     enum ColourIDs
     {
         magnitudeTraceColourID  = 0x8800100,
-        phaseTraceColourID      = 0x8800101
+        phaseTraceColourID      = 0x8800101,
+        groupDelayTraceColourID = 0x8800102
     };
 
-    VASVFTraceComponent(EQParameterReference& ref);
+    // offscreenScaleToUse > 0 starts offscreen, see setOffscreenScale()
+    VASVFTraceComponent(EQParameterReference& ref, double offscreenScaleToUse = 0.0);
 
     ~VASVFTraceComponent() override;
 
@@ -37,8 +42,12 @@ public:
 
     void resized() override;
 
+    // queues the current parameters now, the trace is computed on a background thread
     void update();
 
+    // queues them on the next frame instead, any number of calls per frame cost one update. Any thread
+    void triggerUpdate() noexcept { needsUpdate = true; }
+
     // setters
     void setShowMagnitudeTrace(bool shouldShow) 
     { 
@@ -52,8 +61,24 @@ public:
         repaint();
     }
 
+    void setShowGroupDelayTrace(bool shouldShow)
+    {
+        showGroupDelays = shouldShow;
+        triggerUpdate();
+    }
+
+    // group delay trace spans 0 to this many milliseconds, bottom to top
+    void setGroupDelayRange(double maxMilliseconds);
+
+    // fixed number of evenly spaced points, 0 (the default) derives it from the physical pixel width
     void setNumPoints(int newNumPoints);
 
+    // upper bound on trace updates and repaints per second
+    void setMaxFrameRate(int framesPerSecond);
+
+    // evenly spaced points per physical pixel when the number of points is automatic
+    void setPointsPerPixel(double newPointsPerPixel);
+
     void setFrequencyRange(double start, double end);
 
     void setFrequencyRange(juce::Range<double> r);
@@ -68,13 +93,41 @@ public:
 
     void setSampleRate(double newSampleRate);
 
+    /*
+        Draws the coefficients the processor is actually using, smoothing and dynamic gain
+        included, and takes the sample rate from them. nullptr goes back to designing the
+        state from the parameters. The source has to outlive this component.
+    */
+    void setStateSource(const gedd::SeqLock<gedd::dsp::VASVF::StateSnapshot>* newSource);
+
+    /*
+        For drawing into an image rather than onto the screen, e.g. in the UI
+        benchmarks. The trace thread and the frame timer are left out, update() computes
+        the trace before it returns, with this many physical pixels per logical pixel.
+        Parameter changes aren't picked up until the next update(). 0 goes back to
+        drawing on screen. Constructed offscreen, neither is ever started.
+    */
+    void setOffscreenScale(double newScale);
+
     // getters
     bool getShowMagnitudeTrace() const { return showMagnitudes; }
 
     bool getShowPhaseTrace() const { return showPhases; }
 
+    bool getShowGroupDelayTrace() const { return showGroupDelays; }
+
+    double getGroupDelayRange() const { return groupDelayRange; }
+
     int getNumPoints() const { return numPoints; }
 
+    double getPointsPerPixel() const { return pointsPerPixel; }
+
+    int getMaxFrameRate() const { return maxFrameRate; }
+
+    double getOffscreenScale() const { return offscreenScale; }
+
+    bool isOffscreen() const { return offscreenScale > 0.0; }
+
     juce::Range<double> getFrequencyRange() const { return frequencyRange.getRange(); }
 
     juce::Range<double> getDecibelRange() const { return decibelRange.getRange(); }
@@ -84,48 +137,129 @@ public:
     juce::NormalisableRange<double> getDecibelNormalisableRange() const { return decibelRange; }
 
 private:
-    void redraw() noexcept;
+    // everything needed to draw one trace, captured on the message thread
+    struct TraceRequest
+    {
+        gedd::dsp::VASVF::FilterType type{ gedd::dsp::VASVF::FilterType::none };
+        double frequency{ 1000.0 }, gain{ 0.0 }, q{ 0.7071 }, morph{ 0.0 };
+        bool autoQ{ false };
+
+        // coefficients from the state source, used instead of the parameters
+        bool hasState{ false };
+        std::array<double, 9> stateData{};
+
+        double sampleRate{ 44100.0 };
+        int numPoints{ 0 };
+        double pointsPerPixel{ 0.5 };
+        int frequencyVersion{ 0 };  // bumped whenever the frequency vector has to be rebuilt
+        juce::NormalisableRange<double> frequencyRange, decibelRange;
+        juce::Rectangle<int> bounds;
+        double pixelScale{ 1.0 };   // physical pixels per logical pixel
+
+        bool showGroupDelays{ false };
+        double groupDelayRange{ 10.0 };
+    };
 
-    void handleUpdate() noexcept;
+    struct TracePaths
+    {
+        juce::Path magnitude, phase, groupDelay;
+    };
 
+    // any thread
     void parameterValueChanged(int parameterIndex, float newValue);
 
     void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) {}
 
-    void handleAsyncUpdate() override;
+    // message thread, once per frame
+    void timerCallback() override;
+
+    // trace thread
+    int useTimeSlice() override;
+
+    void computeTrace(const TraceRequest& request, TracePaths& paths);
+
+    void makeDisplayState(const TraceRequest& request);
+
+    static int getNumBasePoints(const TraceRequest& request) noexcept;
+
+    void fillFrequencyVector(const TraceRequest& request, int numBasePoints);
+
+    // magnitude and phase together from the cached response table, group delay when shown
+    void updateResponse(const TraceRequest& request);
+
+    // extra points spread over the bandwidth of sharp poles and zeros the base grid would miss
+    void addResonancePoints(const TraceRequest& request);
 
-    void fillFrequencyVector();
+    void evaluateResonancePoints(const TraceRequest& request);
 
-    void updateMagnitudes();
+    // base and resonance points merged in frequency order
+    void mergePoints(const TraceRequest& request);
 
-    void updatePhases();
+    void createMagnitudePlot(const TraceRequest& request, juce::Path& path) const;
 
-    void createMagnitudePlot();
+    void createPhasePlot(const TraceRequest& request, juce::Path& path) const;
 
-    void createPhasePlot();
+    void createGroupDelayPlot(const TraceRequest& request, juce::Path& path) const;
 
+    //============================================================
     juce::NormalisableRange<double> frequencyRange{ gedd::createFrequencyRange(20.0, 18000.0) };
     juce::NormalisableRange<double> decibelRange{ -24.0, 24.0 };
 
     double  sampleRate{ 44100.0 };
-    int     numPoints{ 256 };
+    int     numPoints{ 0 };
+    double  pointsPerPixel{ 0.5 };
+    int     frequencyVersion{ 0 };
     bool    showMagnitudes{ true };
     bool    showPhases{ true };
+    bool    showGroupDelays{ false };
+    double  groupDelayRange{ 10.0 };
+    int     maxFrameRate{ 60 };
+    double  offscreenScale{ 0.0 };
 
     juce::RangedAudioParameter& freq;
     juce::RangedAudioParameter& gain;
     juce::RangedAudioParameter& q;
     juce::RangedAudioParameter& autoq;
+    juce::RangedAudioParameter& morph;
     juce::RangedAudioParameter& filterType;
 
+    // dirty flag, picked up by the next frame
+    std::atomic<bool> needsUpdate{ false };
+
+    const gedd::SeqLock<gedd::dsp::VASVF::StateSnapshot>* stateSource{ nullptr };
+    uint32_t stateSequence{ 0 };
+
+    // message thread -> trace thread, only the latest request is ever computed
+    gedd::TripleBuffer<TraceRequest> requests;
+
+    // trace thread -> message thread
+    gedd::TripleBuffer<TracePaths> results;
+
+    // trace thread only
     gedd::dsp::VASVF::State<double> displayState;
+    gedd::dsp::VASVF::ResponseTable responseTable;
+    int computedFrequencyVersion{ -1 };
+
+    static constexpr int minPoints{ 32 };
+    static constexpr int maxPoints{ 4096 };
+    static constexpr int pointsPerResonance{ 25 };
+    static constexpr int maxResonances{ 2 };    // one complex pole pair and one complex zero pair
+
+    // evenly spaced in normalised frequency, evaluated through responseTable
+    std::vector<double> baseFrequencies, baseMagnitudes, basePhases, baseGroupDelays;
+
+    // around resonances, evaluated directly
+    std::vector<double> extraFrequencies, extraMagnitudes, extraPhases, extraGroupDelays;
+    size_t numExtraPoints{ 0 };
 
+    // what gets plotted, positions are 0..1 across the width
+    std::vector<double> positions;
     std::vector<double> frequencies;
     std::vector<double> magnitudes;
     std::vector<double> phases;
+    std::vector<double> groupDelays;
 
-    juce::Path frequencyPath;
-    juce::Path phasePath;
+    juce::SharedResourcePointer<gedd::DisplayThread> traceThread;
 
     //============================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VASVFTraceComponent)
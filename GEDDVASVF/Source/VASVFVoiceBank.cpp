@@ -0,0 +1,291 @@
+/*
+  ==============================================================================
+
+    VASVFVoiceBank.cpp
+    Created: 19 Oct 2026 10:12:04am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#include "VASVFVoiceBank.h"
+
+namespace gedd {
+namespace dsp {
+namespace VASVF {
+
+template <typename SampleType>
+void VoiceBank<SampleType>::prepare(const juce::dsp::ProcessSpec& spec, int numVoicesToUse)
+{
+    jassert(spec.sampleRate > 0);
+    jassert(numVoicesToUse > 0);
+
+    sampleRate = spec.sampleRate;
+    numVoices = numVoicesToUse;
+
+    // round up to a whole number of SIMD registers so every group is aligned
+    paddedNumVoices = ((static_cast<size_t>(numVoices) + lanes - 1) / lanes) * lanes;
+
+    dataBlock.allocate(static_cast<size_t>(numArrays) * paddedNumVoices * sizeof(SampleType) + SIMDType::SIMDRegisterSize, true);
+    alignedData = juce::snapPointerToAlignment(reinterpret_cast<SampleType*>(dataBlock.get()), SIMDType::SIMDRegisterSize);
+
+    maskBlock.allocate(paddedNumVoices * sizeof(MaskType) + SIMDType::SIMDRegisterSize, true);
+    alignedMask = juce::snapPointerToAlignment(reinterpret_cast<MaskType*>(maskBlock.get()), SIMDType::SIMDRegisterSize);
+
+    activeInGroup.assign(paddedNumVoices / lanes, 0);
+
+    types.assign(static_cast<size_t>(numVoices), FilterType::lowpass);
+    cutoffs.assign(static_cast<size_t>(numVoices), static_cast<SampleType>(1000));
+    qs.assign(static_cast<size_t>(numVoices), static_cast<SampleType>(0.70710678118654752440L));
+    gains.assign(static_cast<size_t>(numVoices), static_cast<SampleType>(0));
+
+    // padding lanes stay as zeroed, masked off, passthrough coefficients
+    for (auto voice = 0; voice != numVoices; ++voice)
+        updateVoice(voice);
+
+    reset();
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::reset() noexcept
+{
+    std::fill(getArray(ic1Array), getArray(ic1Array) + paddedNumVoices, static_cast<SampleType>(0));
+    std::fill(getArray(ic2Array), getArray(ic2Array) + paddedNumVoices, static_cast<SampleType>(0));
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::resetVoice(int voice) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    getArray(ic1Array)[voice] = static_cast<SampleType>(0);
+    getArray(ic2Array)[voice] = static_cast<SampleType>(0);
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::process(const SampleType* const* inputs, SampleType* const* outputs, int numSamples) noexcept
+{
+    jassert(sampleRate > 0);
+
+    const auto* a1s = getArray(a1Array);
+    const auto* a2s = getArray(a2Array);
+    const auto* a3s = getArray(a3Array);
+    const auto* m0s = getArray(m0Array);
+    const auto* m1s = getArray(m1Array);
+    const auto* m2s = getArray(m2Array);
+    const auto* masks = getMaskArray();
+
+    auto* ic1s = getArray(ic1Array);
+    auto* ic2s = getArray(ic2Array);
+
+    const auto two = SIMDType::expand(static_cast<SampleType>(2));
+
+    alignas(SIMDType::SIMDRegisterSize) SampleType in[lanes] = {};
+    alignas(SIMDType::SIMDRegisterSize) SampleType out[lanes] = {};
+
+    const auto numGroups = paddedNumVoices / lanes;
+
+    for (size_t group = 0; group != numGroups; ++group)
+    {
+        const auto first = group * lanes;
+        const auto last = juce::jmin(first + lanes, static_cast<size_t>(numVoices));
+
+        if (activeInGroup[group] == 0)
+        {
+            for (auto voice = first; voice != last; ++voice)
+                juce::FloatVectorOperations::clear(outputs[voice], numSamples);
+
+            continue;
+        }
+
+        const auto a1 = SIMDType::fromRawArray(a1s + first);
+        const auto a2 = SIMDType::fromRawArray(a2s + first);
+        const auto a3 = SIMDType::fromRawArray(a3s + first);
+        const auto m0 = SIMDType::fromRawArray(m0s + first);
+        const auto m1 = SIMDType::fromRawArray(m1s + first);
+        const auto m2 = SIMDType::fromRawArray(m2s + first);
+        const auto mask = vMaskType::fromRawArray(masks + first);
+
+        auto ic1 = SIMDType::fromRawArray(ic1s + first);
+        auto ic2 = SIMDType::fromRawArray(ic2s + first);
+
+        for (auto sample = 0; sample != numSamples; ++sample)
+        {
+            for (auto voice = first; voice != last; ++voice)
+                in[voice - first] = inputs[voice][sample];
+
+            const auto v0 = SIMDType::fromRawArray(in);
+            const auto v3 = v0 - ic2;
+            const auto v1 = a1 * ic1 + a2 * v3;
+            const auto v2 = ic2 + a2 * ic1 + a3 * v3;
+
+            // masked lanes keep their state
+            ic1 += ((v1 - ic1) * two) & mask;
+            ic2 += ((v2 - ic2) * two) & mask;
+
+            ((m0 * v0 + m1 * v1 + m2 * v2) & mask).copyToRawArray(out);
+
+            for (auto voice = first; voice != last; ++voice)
+                outputs[voice][sample] = out[voice - first];
+        }
+
+        ic1.copyToRawArray(ic1s + first);
+        ic2.copyToRawArray(ic2s + first);
+    }
+
+#if JUCE_SNAP_TO_ZERO
+    for (auto voice = 0; voice != numVoices; ++voice)
+    {
+        juce::dsp::util::snapToZero(ic1s[voice]);
+        juce::dsp::util::snapToZero(ic2s[voice]);
+    }
+#endif
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::setVoiceActive(int voice, bool shouldBeActive) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    if (shouldBeActive == isVoiceActive(voice))
+        return;
+
+    getMaskArray()[voice] = shouldBeActive ? static_cast<MaskType>(-1) : static_cast<MaskType>(0);
+    activeInGroup[static_cast<size_t>(voice) / lanes] += shouldBeActive ? 1 : -1;
+
+    // a new note starts from silence
+    if (shouldBeActive)
+        resetVoice(voice);
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::setVoiceParameters(int voice, FilterType type, SampleType cutoff, SampleType q, SampleType gain) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    types[static_cast<size_t>(voice)] = type;
+    cutoffs[static_cast<size_t>(voice)] = cutoff;
+    qs[static_cast<size_t>(voice)] = q;
+    gains[static_cast<size_t>(voice)] = gain;
+
+    updateVoice(voice);
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::setVoiceType(int voice, FilterType type) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    if (type != types[static_cast<size_t>(voice)])
+    {
+        types[static_cast<size_t>(voice)] = type;
+        updateVoice(voice);
+    }
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::setVoiceCutoff(int voice, SampleType cutoff) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    if (cutoff != cutoffs[static_cast<size_t>(voice)])
+    {
+        cutoffs[static_cast<size_t>(voice)] = cutoff;
+        updateVoice(voice);
+    }
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::setVoiceQ(int voice, SampleType q) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    if (q != qs[static_cast<size_t>(voice)])
+    {
+        qs[static_cast<size_t>(voice)] = q;
+        updateVoice(voice);
+    }
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::setVoiceGain(int voice, SampleType gain) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    if (gain != gains[static_cast<size_t>(voice)])
+    {
+        gains[static_cast<size_t>(voice)] = gain;
+        updateVoice(voice);
+    }
+}
+
+template <typename SampleType>
+bool VoiceBank<SampleType>::isVoiceActive(int voice) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    return getMaskArray()[voice] != static_cast<MaskType>(0);
+}
+
+template <typename SampleType>
+FilterType VoiceBank<SampleType>::getVoiceType(int voice) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    return types[static_cast<size_t>(voice)];
+}
+
+template <typename SampleType>
+SampleType VoiceBank<SampleType>::getVoiceCutoff(int voice) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    return cutoffs[static_cast<size_t>(voice)];
+}
+
+template <typename SampleType>
+SampleType VoiceBank<SampleType>::getVoiceQ(int voice) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    return qs[static_cast<size_t>(voice)];
+}
+
+template <typename SampleType>
+SampleType VoiceBank<SampleType>::getVoiceGain(int voice) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, numVoices));
+
+    return gains[static_cast<size_t>(voice)];
+}
+
+template <typename SampleType>
+void VoiceBank<SampleType>::updateVoice(int voice) noexcept
+{
+    jassert(sampleRate > 0);
+
+    const auto index = static_cast<size_t>(voice);
+    const auto s = ArrayState<SampleType>::make(types[index], sampleRate, cutoffs[index], gains[index], qs[index], false);
+
+    const auto g = s[static_cast<size_t>(1)];
+    const auto k = s[static_cast<size_t>(2)];
+
+    const auto a1 = static_cast<SampleType>(1) / (static_cast<SampleType>(1) + g * (g + k));
+    const auto a2 = g * a1;
+    const auto a3 = g * a2;
+
+    getArray(a1Array)[voice] = a1;
+    getArray(a2Array)[voice] = a2;
+    getArray(a3Array)[voice] = a3;
+    getArray(m0Array)[voice] = s[static_cast<size_t>(3)];
+    getArray(m1Array)[voice] = s[static_cast<size_t>(4)];
+    getArray(m2Array)[voice] = s[static_cast<size_t>(5)];
+}
+
+//=====================================
+template class VoiceBank<float>;
+template class VoiceBank<double>;
+
+}   // namespace VASVF
+}   // namespace dsp
+}   // namespace gedd
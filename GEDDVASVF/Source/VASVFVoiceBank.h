@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    VASVFVoiceBank.h
+    Created: 19 Oct 2026 10:12:04am
+    Author:  GEDD
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "VASVF.h"
+
+namespace gedd {
+namespace dsp {
+namespace VASVF {
+
+    /*
+        Bank of independent VASVF voices for polyphonic use.
+
+        Per voice parameters, coefficients and integrator state are stored as
+        contiguous SoA arrays and processed SIMDRegister::size() voices at a time.
+        Inactive voices are masked out, whole groups of inactive voices are skipped.
+
+        All memory is allocated in prepare(), the per voice setters never allocate.
+    */
+    template <typename SampleType>
+    class VoiceBank
+    {
+    public:
+        using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+        using MaskType = typename SIMDType::MaskType;
+        using vMaskType = typename SIMDType::vMaskType;
+
+        static constexpr size_t lanes = SIMDType::SIMDNumElements;
+
+        VoiceBank() = default;
+
+        // Dsp methods
+        void prepare(const juce::dsp::ProcessSpec& spec, int numVoicesToUse);
+
+        void reset() noexcept;
+
+        void resetVoice(int voice) noexcept;
+
+        /*
+            Processes one input and one output channel per voice, inputs may equal outputs.
+            Outputs of inactive voices are cleared.
+        */
+        void process(const SampleType* const* inputs, SampleType* const* outputs, int numSamples) noexcept;
+
+        // per voice setters - realtime safe
+        void setVoiceActive(int voice, bool shouldBeActive) noexcept;
+
+        void setVoiceParameters(int voice, FilterType type, SampleType cutoff, SampleType q, SampleType gain = 0) noexcept;
+
+        void setVoiceType(int voice, FilterType type) noexcept;
+
+        void setVoiceCutoff(int voice, SampleType cutoff) noexcept;
+
+        void setVoiceQ(int voice, SampleType q) noexcept;
+
+        void setVoiceGain(int voice, SampleType gain) noexcept;
+
+        // getters
+        int getNumVoices() const noexcept { return numVoices; }
+
+        double getSampleRate() const noexcept { return sampleRate; }
+
+        bool isVoiceActive(int voice) const noexcept;
+
+        FilterType getVoiceType(int voice) const noexcept;
+
+        SampleType getVoiceCutoff(int voice) const noexcept;
+
+        SampleType getVoiceQ(int voice) const noexcept;
+
+        SampleType getVoiceGain(int voice) const noexcept;
+
+    private:
+        enum Array
+        {
+            a1Array = 0,
+            a2Array,
+            a3Array,
+            m0Array,
+            m1Array,
+            m2Array,
+            ic1Array,
+            ic2Array,
+            numArrays
+        };
+
+        SampleType* getArray(Array index) const noexcept { return alignedData + static_cast<size_t>(index) * paddedNumVoices; }
+
+        MaskType* getMaskArray() const noexcept { return alignedMask; }
+
+        void updateVoice(int voice) noexcept;
+
+        double sampleRate{ 0.0 };
+        int numVoices{ 0 };
+        size_t paddedNumVoices{ 0 };
+
+        // aligned SoA coefficient & state storage
+        juce::HeapBlock<char> dataBlock;
+        SampleType* alignedData{ nullptr };
+
+        juce::HeapBlock<char> maskBlock;
+        MaskType* alignedMask{ nullptr };
+
+        // number of active voices in each SIMD group
+        std::vector<int> activeInGroup;
+
+        // per voice parameters
+        std::vector<FilterType> types;
+        std::vector<SampleType> cutoffs;
+        std::vector<SampleType> qs;
+        std::vector<SampleType> gains;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VoiceBank)
+    };
+
+}   // namespace VASVF
+}   // namespace dsp
+}   // namespace gedd